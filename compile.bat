@@ -21,14 +21,16 @@ if not exist "build" mkdir build
 
 :: Start compilation - using C++17 standard
 echo Compiling project source files with g++ (C++17 standard)...
-g++ -std=c++17 -Wall -O2 ^
+g++ -std=c++17 -Wall -O2 -pthread ^
     -DUSE_SFML ^
     -Iinclude -Isrc ^
     -I"%SFML_DIR%\include" ^
     -o build\RoboNavPlanner.exe ^
     src\main.cpp ^
     src\core\Map.cpp ^
+    src\core\Logger.cpp ^
     src\core\PathPlanner.cpp ^
+    src\core\PathPostProcessor.cpp ^
     src\config\ConfigManager.cpp ^
     src\visualization\Visualizer.cpp ^
     -L"%SFML_DIR%\lib" ^
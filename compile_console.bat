@@ -10,13 +10,15 @@ if not exist "build" mkdir build
 
 :: Start compilation - using C++17 standard
 echo Compiling console version source files with g++ (C++17 standard)...
-g++ -std=c++17 -Wall -O2 ^
+g++ -std=c++17 -Wall -O2 -pthread ^
     -DCONSOLE_VERSION ^
     -Iinclude -Isrc ^
     -o build\RoboNavPlanner_Console.exe ^
     src\main_console.cpp ^
     src\core\Map.cpp ^
+    src\core\Logger.cpp ^
     src\core\PathPlanner.cpp ^
+    src\core\PathPostProcessor.cpp ^
     src\config\ConfigManager.cpp
 
 if %ERRORLEVEL% EQU 0 (
@@ -2,10 +2,12 @@
 echo 编译算法解耦演示程序...
 
 :: 编译算法演示版本
-g++ -std=c++17 -Iinclude -Isrc -o AlgorithmDemo.exe ^
+g++ -std=c++17 -pthread -Iinclude -Isrc -o AlgorithmDemo.exe ^
     examples/algorithm_demo.cpp ^
     src/core/Map.cpp ^
+    src/core/Logger.cpp ^
     src/core/PathPlanner.cpp ^
+    src/core/PathPostProcessor.cpp ^
     src/algorithm/AlgorithmRegistry.cpp
 
 if %ERRORLEVEL% EQU 0 (
@@ -0,0 +1,30 @@
+@echo off
+chcp 65001 >nul
+echo Compiling RoboNavPlanner Server Version...
+
+:: Add mingw32 to environment PATH
+SET PATH=C:\Tools\mingw32\bin;%PATH%
+
+:: Create build directory if it doesn't exist
+if not exist "build" mkdir build
+
+:: Start compilation - using C++17 standard
+echo Compiling server version source files with g++ (C++17 standard)...
+g++ -std=c++17 -Wall -O2 -pthread ^
+    -DCONSOLE_VERSION ^
+    -Iinclude -Isrc ^
+    -o build\RoboNavPlanner_Server.exe ^
+    src\main_server.cpp ^
+    src\core\Map.cpp ^
+    src\core\Logger.cpp ^
+    src\core\PlanningServer.cpp ^
+    src\core\PathPostProcessor.cpp ^
+    src\config\ConfigManager.cpp
+
+if %ERRORLEVEL% EQU 0 (
+    echo Server version compilation successful! build\RoboNavPlanner_Server.exe has been generated.
+) else (
+    echo Server version compilation failed. Please check the error messages above.
+)
+
+pause 
\ No newline at end of file
@@ -2,6 +2,8 @@
 #define IPATHPLANNINGALGORITHM_H
 
 #include "../Common.h"
+#include <atomic>
+#include <cstdint>
 #include <vector>
 #include <string>
 #include <memory>
@@ -11,6 +13,42 @@
 // 前向声明
 class Map;
 
+/**
+ * @brief 协作式取消令牌
+ *
+ * 由发起规划的一方持有，可在任意线程调用 cancel()。规划在 A* 的每批节点扩展之后
+ * 与每代进化之前检查该标志，取消后尽快返回当前最优路径。
+ */
+class CancellationToken {
+private:
+    std::atomic<bool> cancelled{false};
+
+public:
+    void cancel() { cancelled.store(true, std::memory_order_relaxed); }
+    void reset() { cancelled.store(false, std::memory_order_relaxed); }
+    bool isCancelled() const { return cancelled.load(std::memory_order_relaxed); }
+    const std::atomic<bool>& flag() const { return cancelled; }
+};
+
+// 规划所处阶段
+enum class PlanningStage {
+    Guide,     // A*引导路径搜索
+    Optimize   // PSO进化
+};
+
+// 规划进度
+struct PlanningProgress {
+    PlanningStage stage = PlanningStage::Guide;
+    uint64_t nodesExpanded = 0;    // 已扩展的A*节点数
+    int generation = 0;            // 已完成的进化代数
+    int maxGenerations = 0;        // 最大进化代数
+    double bestFitness = 0.0;      // 当前最优适应度（引导阶段无意义）
+    double elapsedTime = 0.0;      // 自规划开始经过的时间（秒）
+};
+
+// 进度回调：在规划线程（或参与规划的工作线程）上同步调用，应尽快返回
+using PlanningProgressCallback = std::function<void(const PlanningProgress&)>;
+
 // 路径规划请求结构
 struct PathPlanningRequest {
     Point startPoint;           // 起点
@@ -18,26 +56,80 @@ struct PathPlanningRequest {
     Map* map;                   // 地图指针
     int numWaypoints;           // 中间航点数量
     double maxTime;             // 最大计算时间（秒）
+    uint64_t randomSeed;        // 随机种子（相同种子可复现相同结果）
+    const CancellationToken* cancellation;  // 取消令牌（可选，须在规划期间保持有效）
+    PlanningProgressCallback progress;      // 进度回调（可选）
     
     PathPlanningRequest() 
         : startPoint(0, 0), endPoint(0, 0), map(nullptr), 
-          numWaypoints(5), maxTime(30.0) {}
+          numWaypoints(5), maxTime(30.0), randomSeed(1), cancellation(nullptr) {}
+};
+
+// 规划终止原因
+enum class TerminationReason {
+    Completed,        // 正常完成（用满迭代次数或算法自然结束）
+    Stalled,          // 最优解连续多代无显著改进
+    SwarmCollapsed,   // 粒子群收缩到阈值以下
+    TimeLimit,        // 超出时间预算（maxTime）
+    TargetReached,    // 达到目标适应度
+    Cancelled         // 被取消令牌中止
+};
+
+// 终止原因的可读名称
+inline const char* terminationReasonName(TerminationReason reason) {
+    switch (reason) {
+        case TerminationReason::Completed:      return "completed";
+        case TerminationReason::Stalled:        return "stalled";
+        case TerminationReason::SwarmCollapsed: return "swarm-collapsed";
+        case TerminationReason::TimeLimit:      return "time-limit";
+        case TerminationReason::TargetReached:  return "target-reached";
+        case TerminationReason::Cancelled:      return "cancelled";
+    }
+    return "unknown";
+}
+
+// 规划过程统计
+struct PlanningStats {
+    uint64_t collisionCacheHits = 0;    // 线段碰撞缓存命中次数
+    uint64_t collisionCacheMisses = 0;  // 线段碰撞缓存未命中次数
+    uint64_t fitnessEvaluations = 0;             // 适应度评估次数
+    uint64_t evaluationsCutBeforeDeviation = 0;  // 惰性评估跳过偏离惩罚与碰撞检测的次数
+    uint64_t evaluationsCutBeforeCollision = 0;  // 惰性评估仅跳过碰撞检测的次数
+    uint64_t nodesExpanded = 0;         // A*扩展的节点数
+    uint64_t segmentChecks = 0;         // 线段碰撞检测次数（含缓存命中）
+    uint64_t cellsTraversed = 0;        // 碰撞检测实际遍历的网格数
+    
+    // 各阶段耗时（纳秒）
+    int64_t guideNs = 0;                // A*引导路径（含走廊与距离场构建）
+    int64_t swarmInitNs = 0;            // 粒子群创建与初始种群评估
+    int64_t generationsNs = 0;          // 粒子群进化
+    int64_t validationNs = 0;           // 最终路径解码与碰撞校验
+    int64_t totalNs = 0;                // 规划总耗时（不含后处理）
+    
+    // 路径后处理（由 PathPlanner 填写）
+    int64_t postProcessNs = 0;          // 后处理耗时（纳秒）
+    uint64_t postProcessRemovedPoints = 0;  // 捷径删除的路径点数
 };
 
 // 路径规划结果结构
 struct PathPlanningResult {
     std::vector<Point> path;    // 规划出的路径
+    std::vector<Point> guidePath;  // 规划使用的全局引导路径（供重新规划复用，可为空）
     double pathLength;          // 路径长度
     double fitness;             // 适应度值
     bool success;               // 是否成功
     double computationTime;     // 计算耗时（秒）
     std::string algorithmName;  // 算法名称
+    int iterations;             // 实际使用的迭代（进化）次数
+    TerminationReason terminationReason;  // 终止原因
+    PlanningStats stats;        // 规划过程统计
     
     PathPlanningResult(const std::vector<Point>& p = std::vector<Point>(),
                       double length = 0.0, double fit = 0.0, bool succ = false,
                       double time = 0.0, const std::string& name = "Unknown")
         : path(p), pathLength(length), fitness(fit), success(succ),
-          computationTime(time), algorithmName(name) {}
+          computationTime(time), algorithmName(name), iterations(0),
+          terminationReason(TerminationReason::Completed) {}
 };
 
 /**
@@ -68,6 +160,19 @@ public:
      */
     virtual PathPlanningResult planPath(const PathPlanningRequest& request) = 0;
     
+    /**
+     * @brief 以上一次规划结果为基础重新规划（热启动）
+     * @param request 新的规划请求（通常起点已沿上一次的路径前移，终点不变）
+     * @param previous 上一次对同一终点、同一地图的规划结果
+     * @return PathPlanningResult 规划结果
+     * 
+     * 默认实现忽略 previous，等同于 planPath；支持动态重新规划的算法应复用上一次的结果。
+     */
+    virtual PathPlanningResult replanPath(const PathPlanningRequest& request, const PathPlanningResult& previous) {
+        (void)previous;
+        return planPath(request);
+    }
+    
     /**
      * @brief 获取算法名称
      * @return std::string 算法的名称标识
@@ -1,6 +1,7 @@
 #ifndef CONFIG_MANAGER_H
 #define CONFIG_MANAGER_H
 
+#include <cstdint>
 #include <string>
 #include <fstream>
 #include <iostream>
@@ -12,11 +13,55 @@ struct PSOConfig {
     double globalGuideCoe = 2.0;
     double localGuideCoe = 2.0;
     double maxSpeed = 4.0;
+    uint64_t randomSeed = 1;
+    int threadCount = 1;        // 并行评估线程数，1为串行，0为硬件并发数
+    int batchFitness = 1;       // 1为批量评估整个粒子群，0为逐粒子评估
+    int stallGenerations = 0;   // 全局最优连续无改进多少代后停止，0为不启用
+    double improvementThreshold = 0.0;  // 视为改进的最小相对提升
+    double minSwarmDiameter = 0.0;      // 粒子群直径下限，0为不启用
+    int islandCount = 1;        // 岛屿数，大于1时使用岛屿模型多种群算法
+    int migrationInterval = 10; // 岛屿间迁移间隔（代）
+    int migrationSize = 2;      // 每次迁移的精英粒子数
+    int migrationTopology = 0;  // 0为环形拓扑，1为随机拓扑
+    int guidedInit = 1;         // 1为沿A*引导路径初始化粒子，0为全图均匀随机初始化
+    double initJitter = 1.0;    // 引导初始化的高斯扰动标准差
+    double randomInitFraction = 0.2;  // 引导初始化时仍均匀随机初始化的粒子比例
+    double corridorMargin = 0.0;      // 航点走廊搜索边界的外扩距离，0为整张地图
+    double distanceFieldResolution = 0.25;  // 偏离惩罚距离场网格间距，0为逐段精确计算
+    int collisionCacheSize = 65536;   // 线段碰撞缓存槽位数，0为不缓存
+    int lazyEvaluation = 1;           // 1为惰性评估（不可能超过个体最优时跳过昂贵项），0为完整计算
+    int staticDimension = 1;          // 1为常用维度使用编译期维度特化的PSO引擎，0为始终使用运行时维度
+    int useFloat = 0;                 // 1为粒子位置与速度使用单精度（适应度仍为双精度）
+    int asyncMode = 0;                // 1为异步（稳态）进化，线程间无每代屏障；多线程下结果不可复现
+    int parameterControl = 0;         // 0固定参数，1线性递减惯性权重，2收缩因子，3按成功率调整最大速度
+    double inertiaStart = 0.9;        // 线性递减惯性权重初值
+    double inertiaEnd = 0.4;          // 线性递减惯性权重终值
+    int traceCapacity = 0;            // 逐代收敛记录的环形缓冲区容量（代），0为不记录
+    int replanGenerations = 0;        // 热启动重新规划的最大进化代数，0为与generations相同
 };
 
 struct PathPlanningConfig {
     int numWaypoints = 6;
     double mapCellSize = 1.0;
+    int adaptiveWaypoints = 0;        // 1为由引导路径的显著拐点数确定航点数（numWaypoints 不再使用）
+    int minWaypoints = 2;             // 自适应航点数下限
+    int maxWaypoints = 10;            // 自适应航点数上限
+    double waypointsPerTurn = 2.0;    // 每个显著拐点分配的航点数
+    double turnAngleThreshold = 20.0; // 显著拐点的最小转角（度）
+};
+
+struct PostProcessingConfig {
+    int enabled = 0;              // 1为对规划结果做后处理
+    int shortcut = 1;             // 1为贪心视线捷径
+    int smoothing = 0;            // 1为样条平滑并按固定弧长采样
+    double sampleSpacing = 0.25;  // 样条采样的弧长间距
+    double maxCurvature = 2.0;    // 样条曲率上限，0为不限制
+};
+
+struct ServerConfig {
+    int workers = 0;              // 规划服务的并发工作线程数，0为硬件并发数
+    int planThreads = 1;          // 服务中每次规划的评估线程数（覆盖 pso.threadCount）
+    int queueCapacity = 1024;     // 待处理请求队列容量，队列满时暂停读取请求
 };
 
 struct VisualizationConfig {
@@ -25,12 +70,34 @@ struct VisualizationConfig {
     int frameRate = 60;
 };
 
+struct LoggingConfig {
+    std::string level = "info";  // 运行期日志级别：trace/debug/info/warn/error/off
+};
+
 struct AppConfig {
     PSOConfig pso;
     PathPlanningConfig pathPlanning;
+    PostProcessingConfig postProcessing;
+    ServerConfig server;
     VisualizationConfig visualization;
+    LoggingConfig logging;
 };
 
+class IPathPlanningAlgorithm;
+
+/**
+ * 把配置中的算法参数写入算法实例（GUI、控制台与规划服务共用）
+ * islandCount 大于1时调用者应传入岛屿模型算法，此时同时写入迁移参数。
+ * 个别入口需要不同取值的参数（控制台导出收敛记录时的 traceCapacity、
+ * 规划服务的 threadCount）由调用者在此之后覆盖。
+ */
+void configureAlgorithm(const AppConfig& config, IPathPlanningAlgorithm& algorithm);
+
+struct PostProcessingOptions;
+
+// 由配置中的 postProcessing 节生成路径后处理选项（是否启用由调用者读取 enabled 决定）
+PostProcessingOptions postProcessingOptions(const AppConfig& config);
+
 class ConfigManager {
 public:
     ConfigManager();
@@ -52,6 +119,7 @@ private:
     std::string trim(const std::string& str);
     double parseDouble(const std::string& value);
     int parseInt(const std::string& value);
+    uint64_t parseUInt64(const std::string& value);
 };
 
 #endif // CONFIG_MANAGER_H 
\ No newline at end of file
@@ -9,6 +9,7 @@
 #include <cmath>
 #include <memory>
 #include <algorithm>
+#include <functional>
 
 /**
  * @brief A*算法节点结构
@@ -31,9 +32,16 @@ struct AStarNode {
  * @brief A*算法实现类
  * 
  * 独立的A*算法实现，可以在网格地图上规划从起点到终点的路径
+ * 
+ * 本类不实现 IPathPlanningAlgorithm，没有自己的 PlanningStats：扩展节点数只通过
+ * getNodesExpanded 读取，由 HybridAStarPSOAlgorithm 写入其结果的 stats.nodesExpanded
+ * 与进度回调；单独使用本类时直接调用 getNodesExpanded。
  */
 class AStarAlgorithm {
 private:
+    uint64_t nodesExpanded = 0;  // 上一次搜索扩展（出队）的节点数
+    bool aborted = false;        // 上一次搜索是否被检查点中止
+    
     // 8方向移动的偏移量
     const std::vector<std::pair<int, int>> directions = {
         {-1, -1}, {-1, 0}, {-1, 1},  // 左上、上、右上
@@ -100,14 +108,21 @@ private:
     }
 
 public:
+    static constexpr uint64_t CHECKPOINT_INTERVAL = 256;  // 每扩展多少个节点调用一次检查点
+    
     /**
      * @brief A*路径查找主函数
      * @param map 地图引用
      * @param start 起点世界坐标
      * @param end 终点世界坐标
-     * @return std::vector<Point> 路径点序列，如果无法找到路径则返回空向量
+     * @param checkpoint 每扩展 CHECKPOINT_INTERVAL 个节点调用一次，参数为已扩展节点数，
+     *                   返回 false 时中止搜索（可为空）
+     * @return std::vector<Point> 路径点序列，如果无法找到路径或被中止则返回空向量
      */
-    std::vector<Point> findPath(const Map& map, Point start, Point end) {
+    std::vector<Point> findPath(const Map& map, Point start, Point end,
+                                const std::function<bool(uint64_t)>& checkpoint = nullptr) {
+        nodesExpanded = 0;
+        aborted = false;
         double cellSize = map.getCellSize();
         int mapWidth = map.getWidth();
         int mapHeight = map.getHeight();
@@ -155,6 +170,11 @@ public:
             // 获取f值最小的节点
             AStarNode current = openList.top();
             openList.pop();
+            nodesExpanded++;
+            if (checkpoint && nodesExpanded % CHECKPOINT_INTERVAL == 0 && !checkpoint(nodesExpanded)) {
+                aborted = true;
+                return std::vector<Point>();
+            }
             
             int currentId = getNodeId(current.x, current.y, mapWidth);
             openSet.erase(currentId);
@@ -240,6 +260,28 @@ public:
     std::string getAlgorithmName() const {
         return "A*";
     }
+    
+    /**
+     * @brief 获取上一次 findPath 扩展的节点数
+     */
+    uint64_t getNodesExpanded() const {
+        return nodesExpanded;
+    }
+    
+    /**
+     * @brief 清零扩展节点数与中止标志（本次规划不运行 findPath 时调用）
+     */
+    void resetStatistics() {
+        nodesExpanded = 0;
+        aborted = false;
+    }
+    
+    /**
+     * @brief 上一次 findPath 是否被检查点中止
+     */
+    bool wasAborted() const {
+        return aborted;
+    }
 };
 
 #endif // ASTARALGORITHM_H 
\ No newline at end of file
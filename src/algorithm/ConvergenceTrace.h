@@ -0,0 +1,140 @@
+#ifndef CONVERGENCE_TRACE_H
+#define CONVERGENCE_TRACE_H
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/**
+ * @brief 逐代收敛过程记录（固定容量环形缓冲区）
+ *
+ * 记录数组在 reset 时一次性分配，记录过程不分配内存；写满后覆盖最早的记录，
+ * 因此总是保留最近 capacity 代。未挂接到粒子群时不产生任何开销。
+ */
+class ConvergenceTrace {
+public:
+    struct Record {
+        int generation;          // 代数（0为初始种群）
+        double bestFitness;      // 全局最优适应度
+        double meanFitness;      // 本代粒子适应度均值（惰性评估被截断的粒子计入其上界）
+        double swarmDiameter;    // 粒子位置包围盒对角线长度
+        int64_t elapsedNs;       // 自搜索开始经过的纳秒数
+    };
+
+private:
+    std::vector<Record> records;
+    size_t head;                 // 最早一条记录的位置
+    size_t count;
+    uint64_t totalRecorded;
+    std::chrono::steady_clock::time_point origin;
+
+public:
+    explicit ConvergenceTrace(size_t capacity = 0) : head(0), count(0), totalRecorded(0) {
+        reset(capacity);
+    }
+
+    /**
+     * @brief 重新设定容量并清空
+     */
+    void reset(size_t capacity) {
+        records.assign(capacity, Record());
+        clear();
+    }
+
+    /**
+     * @brief 清空记录并以当前时刻作为计时起点
+     */
+    void clear() {
+        head = 0;
+        count = 0;
+        totalRecorded = 0;
+        origin = std::chrono::steady_clock::now();
+    }
+
+    size_t capacity() const { return records.size(); }
+    size_t size() const { return count; }
+
+    /**
+     * @brief 被覆盖而丢失的记录数
+     */
+    uint64_t dropped() const { return totalRecorded - count; }
+
+    /**
+     * @brief 追加一条记录（耗时由本函数填写）
+     */
+    void record(int generation, double bestFitness, double meanFitness, double swarmDiameter) {
+        if (records.empty()) {
+            return;
+        }
+        auto elapsed = std::chrono::steady_clock::now() - origin;
+        Record entry{generation, bestFitness, meanFitness, swarmDiameter,
+                     std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()};
+        if (count < records.size()) {
+            records[(head + count) % records.size()] = entry;
+            count++;
+        } else {
+            records[head] = entry;
+            head = (head + 1) % records.size();
+        }
+        totalRecorded++;
+    }
+
+    /**
+     * @brief 按时间顺序访问第 index 条记录
+     */
+    const Record& operator[](size_t index) const {
+        return records[(head + index) % records.size()];
+    }
+
+    /**
+     * @brief 以CSV格式导出（含表头）
+     */
+    void writeCsv(std::ostream& out) const {
+        std::streamsize precision = out.precision(10);
+        out << "generation,best_fitness,mean_fitness,swarm_diameter,elapsed_ns\n";
+        for (size_t i = 0; i < count; i++) {
+            const Record& r = (*this)[i];
+            out << r.generation << ',' << r.bestFitness << ',' << r.meanFitness << ','
+                << r.swarmDiameter << ',' << r.elapsedNs << '\n';
+        }
+        out.precision(precision);
+    }
+
+    /**
+     * @brief 以JSON格式导出
+     */
+    void writeJson(std::ostream& out) const {
+        std::streamsize precision = out.precision(10);
+        out << "{\n  \"dropped\": " << dropped() << ",\n  \"generations\": [";
+        for (size_t i = 0; i < count; i++) {
+            const Record& r = (*this)[i];
+            out << (i == 0 ? "\n" : ",\n")
+                << "    {\"generation\": " << r.generation
+                << ", \"best_fitness\": " << jsonNumber(r.bestFitness)
+                << ", \"mean_fitness\": " << jsonNumber(r.meanFitness)
+                << ", \"swarm_diameter\": " << jsonNumber(r.swarmDiameter)
+                << ", \"elapsed_ns\": " << r.elapsedNs << "}";
+        }
+        out << "\n  ]\n}\n";
+        out.precision(precision);
+    }
+
+private:
+    // JSON 不支持 inf/nan，以 null 表示
+    struct JsonNumber {
+        double value;
+    };
+    static JsonNumber jsonNumber(double value) { return {value}; }
+    friend std::ostream& operator<<(std::ostream& out, const JsonNumber& number) {
+        if (std::isfinite(number.value)) {
+            out << number.value;
+        } else {
+            out << "null";
+        }
+        return out;
+    }
+};
+
+#endif // CONVERGENCE_TRACE_H
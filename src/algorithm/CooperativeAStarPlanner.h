@@ -0,0 +1,616 @@
+#ifndef COOPERATIVE_ASTAR_PLANNER_H
+#define COOPERATIVE_ASTAR_PLANNER_H
+
+#include "../../include/Common.h"
+#include "../core/Map.h"
+#include "ReservationTable.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <queue>
+#include <string>
+#include <vector>
+
+/**
+ * @brief 多机器人规划方式
+ */
+enum class MultiAgentMode {
+    Prioritized,          // 优先级规划：按顺序逐个规划，已规划的路径写入预约表
+    ConflictBasedSearch   // 基于冲突的搜索（CBS）：在约束树上消解冲突，结果的总代价最优
+};
+
+/**
+ * @brief 单个机器人的起点与终点（世界坐标）
+ */
+struct MultiAgentTask {
+    Point start;
+    Point goal;
+
+    MultiAgentTask(const Point& s = Point(), const Point& g = Point()) : start(s), goal(g) {}
+};
+
+/**
+ * @brief 多机器人规划结果
+ */
+struct MultiAgentResult {
+    std::vector<std::vector<Point>> paths;  // 每个机器人每个时间步所在网格的中心，到达终点后停留不动（失败为空）
+    bool success = false;          // 全部机器人都找到了互不冲突的路径
+    int solvedAgents = 0;          // 找到路径的机器人数
+    int makespan = 0;              // 最晚到达终点的时间步
+    long sumOfCosts = 0;           // 各机器人到达终点的时间步之和
+    uint64_t nodesExpanded = 0;    // 时空A*扩展的节点数（全部低层搜索之和）
+    int highLevelNodes = 0;        // CBS展开的约束树节点数（优先级规划为0）
+    double computationTime = 0.0;  // 计算耗时（秒）
+};
+
+/**
+ * @brief 多机器人协同路径规划器（时空A*）
+ *
+ * 机器人在4连通网格上每个时间步移动一格或原地等待。低层是 (网格, 时间步) 上的时空A*，
+ * 以到终点的反向BFS距离为启发式；同一时刻占用同一网格（顶点冲突）与相邻两格对换（边冲突）都视为冲突。
+ * 优先级规划把已规划机器人的占用写入哈希预约表，后规划的机器人绕开它们；
+ * CBS 在约束树上逐个消解冲突（低层在 f 相同时优先选择与其他机器人冲突少的路径），
+ * 节点数或时间超出上限时返回失败。
+ * 非线程安全，每个线程使用独立实例。
+ */
+class CooperativeAStarPlanner {
+public:
+    // CBS 约束：机器人在 step 时刻不得位于 cell（fromCell<0），或不得在 step 时刻由 fromCell 移动到 cell
+    struct Constraint {
+        int agent;
+        int cell;
+        int fromCell;
+        int step;
+    };
+
+    // 两个机器人之间的冲突
+    struct Conflict {
+        int agentA, agentB;
+        int cell;       // 顶点冲突的网格；边冲突时为 agentA 移入的网格
+        int fromCell;   // 边冲突时 agentA 移出的网格；顶点冲突为 -1
+        int step;
+    };
+
+private:
+    MultiAgentMode mode;
+    int maxTimesteps;        // 时空搜索的时间步上限（0为按地图尺寸自动确定）
+    int maxHighLevelNodes;   // CBS约束树节点上限
+    double maxTime;          // CBS计算时间上限（秒，<=0为不限）
+
+    const Map* map = nullptr;
+    int width = 0;
+    int height = 0;
+    int horizon = 0;
+
+    ReservationTable reservations;
+    ReservationTable avoidance;  // CBS：其他机器人当前路径的占用，低层搜索在 f 相同时优先冲突少的节点
+    std::vector<std::vector<int>> goalDistances;  // 各机器人到终点的反向BFS距离（启发式）
+    uint64_t nodesExpanded = 0;
+
+    // 时空A*的搜索节点
+    struct Node {
+        int cell;
+        int step;
+        int parent;
+        int conflicts;  // 路径上与 avoidance 表冲突的次数
+    };
+    std::vector<Node> nodes;
+
+    // 已访问 (网格, 时间步) 集合（开放寻址，每次搜索清空后复用）
+    class StateSet {
+    private:
+        std::vector<uint64_t> keys;
+        size_t count = 0;
+        static constexpr uint64_t EMPTY_KEY = ~0ULL;
+
+        static size_t hashKey(uint64_t key) {
+            key ^= key >> 33;
+            key *= 0xFF51AFD7ED558CCDULL;
+            key ^= key >> 33;
+            return static_cast<size_t>(key);
+        }
+
+    public:
+        void clear() {
+            if (keys.empty()) {
+                keys.assign(1 << 12, EMPTY_KEY);
+            } else if (count > 0) {
+                std::fill(keys.begin(), keys.end(), EMPTY_KEY);
+            }
+            count = 0;
+        }
+
+        // 插入状态，已存在时返回 false
+        bool insert(int cell, int step) {
+            if ((count + 1) * 2 > keys.size()) {
+                std::vector<uint64_t> old;
+                old.swap(keys);
+                keys.assign(old.size() * 2, EMPTY_KEY);
+                count = 0;
+                for (uint64_t key : old) {
+                    if (key != EMPTY_KEY) {
+                        insertKey(key);
+                    }
+                }
+            }
+            return insertKey((static_cast<uint64_t>(static_cast<uint32_t>(step)) << 32) | static_cast<uint32_t>(cell));
+        }
+
+        bool insertKey(uint64_t key) {
+            size_t mask = keys.size() - 1;
+            size_t index = hashKey(key) & mask;
+            while (keys[index] != EMPTY_KEY) {
+                if (keys[index] == key) {
+                    return false;
+                }
+                index = (index + 1) & mask;
+            }
+            keys[index] = key;
+            count++;
+            return true;
+        }
+    };
+    StateSet closed;
+
+    int cellOf(const Point& p) const {
+        int x = static_cast<int>(p.x / map->getCellSize());
+        int y = static_cast<int>(p.y / map->getCellSize());
+        if (x < 0 || x >= width || y < 0 || y >= height) {
+            return -1;
+        }
+        return y * width + x;
+    }
+
+    Point centerOf(int cell) const {
+        double cellSize = map->getCellSize();
+        return Point((cell % width) * cellSize + cellSize * 0.5, (cell / width) * cellSize + cellSize * 0.5);
+    }
+
+    bool isFree(int cell) const {
+        return map->getCell(cell % width, cell / width) == 0;
+    }
+
+    /**
+     * @brief 4连通邻居（不含原地等待），返回邻居数
+     */
+    int neighbors(int cell, int* out) const {
+        int x = cell % width;
+        int y = cell / width;
+        int n = 0;
+        if (x > 0) out[n++] = cell - 1;
+        if (x + 1 < width) out[n++] = cell + 1;
+        if (y > 0) out[n++] = cell - width;
+        if (y + 1 < height) out[n++] = cell + width;
+        return n;
+    }
+
+    /**
+     * @brief 从终点反向BFS计算各网格到终点的步数（不可达为INT_MAX）
+     */
+    void computeGoalDistance(int goal, std::vector<int>& distance) const {
+        distance.assign(static_cast<size_t>(width) * height, INT_MAX);
+        std::deque<int> queue;
+        distance[goal] = 0;
+        queue.push_back(goal);
+        int adjacent[4];
+        while (!queue.empty()) {
+            int cell = queue.front();
+            queue.pop_front();
+            int count = neighbors(cell, adjacent);
+            for (int k = 0; k < count; k++) {
+                int next = adjacent[k];
+                if (distance[next] == INT_MAX && isFree(next)) {
+                    distance[next] = distance[cell] + 1;
+                    queue.push_back(next);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief 检查一步移动是否违反约束（预约表或CBS约束）
+     */
+    bool isBlocked(int agent, int from, int to, int step, const ReservationTable* table,
+                   const std::vector<Constraint>* constraints) const {
+        if (table) {
+            int occupant = table->owner(to, step);
+            if (occupant != ReservationTable::NONE && occupant != agent) {
+                return true;
+            }
+            // 与另一机器人对换位置
+            int other = table->owner(to, step - 1);
+            if (from != to && other != ReservationTable::NONE && other != agent && table->owner(from, step) == other) {
+                return true;
+            }
+        }
+        if (constraints) {
+            for (const Constraint& c : *constraints) {
+                if (c.step == step && c.cell == to && (c.fromCell < 0 || c.fromCell == from)) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief 单个机器人的时空A*
+     * @param agent 机器人编号
+     * @param start 起点网格
+     * @param goal 终点网格
+     * @param table 预约表（可为空）
+     * @param constraints 该机器人的CBS约束（可为空）
+     * @param avoid 尽量避开（不强制）的占用表（可为空）
+     * @param path 输出的逐时间步网格序列
+     * @return bool 是否找到路径
+     */
+    bool searchAgent(int agent, int start, int goal, const ReservationTable* table,
+                     const std::vector<Constraint>* constraints, const ReservationTable* avoid,
+                     std::vector<int>& path) {
+        path.clear();
+        const std::vector<int>& distance = goalDistances[agent];
+        if (distance[start] == INT_MAX) {
+            return false;
+        }
+
+        // 停在终点之后不能再有其他机器人经过：到达时刻须晚于终点上的全部预约与约束
+        int earliestFinish = 0;
+        if (table) {
+            int since;
+            int parked = table->parkedAt(goal, since);
+            if (parked != ReservationTable::NONE && parked != agent) {
+                return false;
+            }
+            earliestFinish = table->lastReserved(goal) + 1;
+        }
+        if (constraints) {
+            for (const Constraint& c : *constraints) {
+                if (c.cell == goal && c.fromCell < 0) {
+                    earliestFinish = std::max(earliestFinish, c.step + 1);
+                }
+            }
+        }
+
+        // 开启列表按 f 升序，f 相同时冲突少者优先，再相同时时间步大者优先
+        using Entry = std::pair<std::pair<int, int>, std::pair<int, int>>;  // ((f, 冲突数), (-step, 节点下标))
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+        nodes.clear();
+        closed.clear();
+        nodes.push_back({start, 0, -1, 0});
+        closed.insert(start, 0);
+        open.push({{distance[start], 0}, {0, 0}});
+
+        int adjacent[5];
+        while (!open.empty()) {
+            int index = open.top().second.second;
+            open.pop();
+            Node current = nodes[index];
+            nodesExpanded++;
+
+            if (current.cell == goal && current.step >= earliestFinish) {
+                for (int i = index; i >= 0; i = nodes[i].parent) {
+                    path.push_back(nodes[i].cell);
+                }
+                std::reverse(path.begin(), path.end());
+                return true;
+            }
+            if (current.step + 1 >= horizon) {
+                continue;
+            }
+
+            int count = neighbors(current.cell, adjacent);
+            adjacent[count++] = current.cell;  // 原地等待
+            for (int k = 0; k < count; k++) {
+                int next = adjacent[k];
+                int step = current.step + 1;
+                if (distance[next] == INT_MAX || !isFree(next) ||
+                    isBlocked(agent, current.cell, next, step, table, constraints) ||
+                    !closed.insert(next, step)) {
+                    continue;
+                }
+                int conflicts = current.conflicts +
+                                (avoid && isBlocked(agent, current.cell, next, step, avoid, nullptr) ? 1 : 0);
+                nodes.push_back({next, step, index, conflicts});
+                open.push({{step + distance[next], conflicts}, {-step, static_cast<int>(nodes.size()) - 1}});
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief 在网格路径集合中查找最早的冲突（到达终点后视为停留不动）
+     */
+    bool findFirstConflict(const std::vector<std::vector<int>>& paths, Conflict& conflict) const {
+        size_t makespan = 0;
+        for (const std::vector<int>& path : paths) {
+            makespan = std::max(makespan, path.size());
+        }
+        auto position = [&paths](size_t agent, size_t step) {
+            const std::vector<int>& path = paths[agent];
+            return path[std::min(step, path.size() - 1)];
+        };
+
+        std::vector<int> occupant(static_cast<size_t>(width) * height, -1);
+        std::vector<int> previous(occupant.size(), -1);
+        for (size_t step = 0; step < makespan; step++) {
+            for (size_t a = 0; a < paths.size(); a++) {
+                if (paths[a].empty()) {
+                    continue;
+                }
+                int cell = position(a, step);
+                if (occupant[cell] >= 0) {
+                    conflict = {occupant[cell], static_cast<int>(a), cell, -1, static_cast<int>(step)};
+                    return true;
+                }
+                occupant[cell] = static_cast<int>(a);
+                if (step > 0) {
+                    int from = position(a, step - 1);
+                    int other = previous[cell];
+                    if (from != cell && other >= 0 && other != static_cast<int>(a) &&
+                        position(other, step) == from) {
+                        conflict = {static_cast<int>(a), other, cell, from, static_cast<int>(step)};
+                        return true;
+                    }
+                }
+            }
+            // 本时间步的占用成为下一步的 previous，只清除本步写入的网格
+            for (size_t a = 0; a < paths.size(); a++) {
+                if (!paths[a].empty() && step > 0) {
+                    previous[position(a, step - 1)] = -1;
+                }
+            }
+            for (size_t a = 0; a < paths.size(); a++) {
+                if (!paths[a].empty()) {
+                    int cell = position(a, step);
+                    previous[cell] = static_cast<int>(a);
+                    occupant[cell] = -1;
+                }
+            }
+        }
+        return false;
+    }
+
+    bool prepare(const Map& targetMap, const std::vector<MultiAgentTask>& tasks,
+                 std::vector<int>& starts, std::vector<int>& goals) {
+        map = &targetMap;
+        width = targetMap.getWidth();
+        height = targetMap.getHeight();
+        horizon = maxTimesteps > 0 ? maxTimesteps : 4 * (width + height) + static_cast<int>(tasks.size());
+        nodesExpanded = 0;
+        starts.resize(tasks.size());
+        goals.resize(tasks.size());
+        goalDistances.resize(tasks.size());
+        bool valid = true;
+        for (size_t a = 0; a < tasks.size(); a++) {
+            starts[a] = cellOf(tasks[a].start);
+            goals[a] = cellOf(tasks[a].goal);
+            if (starts[a] < 0 || goals[a] < 0 || !isFree(starts[a]) || !isFree(goals[a])) {
+                goalDistances[a].assign(static_cast<size_t>(width) * height, INT_MAX);
+                valid = false;
+                continue;
+            }
+            computeGoalDistance(goals[a], goalDistances[a]);
+        }
+        return valid;
+    }
+
+    void finish(const std::vector<std::vector<int>>& cellPaths, MultiAgentResult& result) const {
+        result.paths.assign(cellPaths.size(), std::vector<Point>());
+        result.solvedAgents = 0;
+        result.makespan = 0;
+        result.sumOfCosts = 0;
+        for (size_t a = 0; a < cellPaths.size(); a++) {
+            if (cellPaths[a].empty()) {
+                continue;
+            }
+            for (int cell : cellPaths[a]) {
+                result.paths[a].push_back(centerOf(cell));
+            }
+            int cost = static_cast<int>(cellPaths[a].size()) - 1;
+            result.solvedAgents++;
+            result.makespan = std::max(result.makespan, cost);
+            result.sumOfCosts += cost;
+        }
+        result.success = result.solvedAgents == static_cast<int>(cellPaths.size());
+        result.nodesExpanded = nodesExpanded;
+    }
+
+    void planPrioritized(const std::vector<int>& starts, const std::vector<int>& goals,
+                         std::vector<std::vector<int>>& paths) {
+        reservations.reset(width * height);
+        // 尚未规划的机器人在 0 时刻位于各自起点
+        for (size_t a = 0; a < starts.size(); a++) {
+            reservations.reserve(starts[a], 0, static_cast<int>(a));
+        }
+        for (size_t a = 0; a < starts.size(); a++) {
+            int agent = static_cast<int>(a);
+            if (!searchAgent(agent, starts[a], goals[a], &reservations, nullptr, nullptr, paths[a])) {
+                continue;
+            }
+            for (size_t step = 0; step < paths[a].size(); step++) {
+                reservations.reserve(paths[a][step], static_cast<int>(step), agent);
+            }
+            reservations.park(goals[a], static_cast<int>(paths[a].size()) - 1, agent);
+        }
+    }
+
+    // CBS 约束树节点
+    struct ConstraintNode {
+        std::vector<Constraint> constraints;
+        std::vector<std::vector<int>> paths;
+        long cost = 0;
+    };
+
+    static long pathsCost(const std::vector<std::vector<int>>& paths) {
+        long cost = 0;
+        for (const std::vector<int>& path : paths) {
+            cost += static_cast<long>(path.size()) - 1;
+        }
+        return cost;
+    }
+
+    bool replanWithConstraints(ConstraintNode& node, int agent, const std::vector<int>& starts,
+                               const std::vector<int>& goals) {
+        std::vector<Constraint> own;
+        for (const Constraint& c : node.constraints) {
+            if (c.agent == agent) {
+                own.push_back(c);
+            }
+        }
+        avoidance.reset(width * height);
+        for (size_t other = 0; other < node.paths.size(); other++) {
+            const std::vector<int>& path = node.paths[other];
+            if (static_cast<int>(other) == agent || path.empty()) {
+                continue;
+            }
+            for (size_t step = 0; step < path.size(); step++) {
+                avoidance.reserve(path[step], static_cast<int>(step), static_cast<int>(other));
+            }
+            avoidance.park(path.back(), static_cast<int>(path.size()) - 1, static_cast<int>(other));
+        }
+        return searchAgent(agent, starts[agent], goals[agent], nullptr, &own, &avoidance, node.paths[agent]);
+    }
+
+    bool planConflictBased(const std::vector<int>& starts, const std::vector<int>& goals,
+                           std::vector<std::vector<int>>& paths, int& expandedNodes) {
+        // 时间上限超过时钟可表示范围一半（约146年）时视为不限，避免换算为纳秒计数时溢出
+        auto now = std::chrono::steady_clock::now();
+        double representable = std::chrono::duration<double>(std::chrono::steady_clock::time_point::max() - now).count();
+        const bool useDeadline = maxTime > 0.0 && maxTime < representable / 2;
+        auto deadline = useDeadline ? now + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                                std::chrono::duration<double>(maxTime))
+                                    : std::chrono::steady_clock::time_point::max();
+        std::vector<std::unique_ptr<ConstraintNode>> tree;
+        using Entry = std::pair<std::pair<long, int>, int>;  // ((代价, 约束数), 节点下标)
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> open;
+
+        auto root = std::make_unique<ConstraintNode>();
+        root->paths.resize(starts.size());
+        for (size_t a = 0; a < starts.size(); a++) {
+            if (!replanWithConstraints(*root, static_cast<int>(a), starts, goals)) {
+                paths = root->paths;
+                return false;
+            }
+        }
+        root->cost = pathsCost(root->paths);
+        tree.push_back(std::move(root));
+        open.push({{tree[0]->cost, 0}, 0});
+
+        expandedNodes = 0;
+        while (!open.empty()) {
+            if (expandedNodes >= maxHighLevelNodes ||
+                (useDeadline && std::chrono::steady_clock::now() >= deadline)) {
+                break;
+            }
+            int index = open.top().second;
+            open.pop();
+            expandedNodes++;
+
+            Conflict conflict;
+            if (!findFirstConflict(tree[index]->paths, conflict)) {
+                paths = tree[index]->paths;
+                return true;
+            }
+
+            // 分别禁止冲突双方中的一个
+            for (int side = 0; side < 2; side++) {
+                Constraint constraint;
+                if (conflict.fromCell < 0) {
+                    constraint = {side == 0 ? conflict.agentA : conflict.agentB, conflict.cell, -1, conflict.step};
+                } else if (side == 0) {
+                    constraint = {conflict.agentA, conflict.cell, conflict.fromCell, conflict.step};
+                } else {
+                    constraint = {conflict.agentB, conflict.fromCell, conflict.cell, conflict.step};
+                }
+                auto child = std::make_unique<ConstraintNode>();
+                child->constraints = tree[index]->constraints;
+                child->constraints.push_back(constraint);
+                child->paths = tree[index]->paths;
+                if (!replanWithConstraints(*child, constraint.agent, starts, goals)) {
+                    continue;
+                }
+                child->cost = pathsCost(child->paths);
+                int childIndex = static_cast<int>(tree.size());
+                open.push({{child->cost, static_cast<int>(child->constraints.size())}, childIndex});
+                tree.push_back(std::move(child));
+            }
+            // 已展开节点的路径不再需要
+            tree[index]->paths.clear();
+            tree[index]->paths.shrink_to_fit();
+        }
+        paths.assign(starts.size(), std::vector<int>());
+        return false;
+    }
+
+public:
+    CooperativeAStarPlanner()
+        : mode(MultiAgentMode::Prioritized), maxTimesteps(0), maxHighLevelNodes(10000), maxTime(10.0) {}
+
+    void setMode(MultiAgentMode value) { mode = value; }
+    MultiAgentMode getMode() const { return mode; }
+
+    /**
+     * @brief 时空搜索的时间步上限（0为按地图尺寸与机器人数自动确定）
+     */
+    void setMaxTimesteps(int value) { maxTimesteps = std::max(0, value); }
+
+    /**
+     * @brief CBS 的约束树节点上限与计算时间上限（秒，<=0为不限）
+     */
+    void setSearchLimits(int highLevelNodes, double seconds) {
+        maxHighLevelNodes = std::max(1, highLevelNodes);
+        maxTime = seconds;
+    }
+
+    /**
+     * @brief 为一组机器人规划互不冲突的路径
+     * @param targetMap 地图
+     * @param tasks 各机器人的起点与终点（起点互不相同，终点互不相同）
+     * @return MultiAgentResult 规划结果；优先级规划中个别机器人失败时其路径为空，其余路径仍互不冲突
+     */
+    MultiAgentResult plan(const Map& targetMap, const std::vector<MultiAgentTask>& tasks) {
+        auto startTime = std::chrono::steady_clock::now();
+        MultiAgentResult result;
+        std::vector<int> starts, goals;
+        std::vector<std::vector<int>> paths(tasks.size());
+        if (prepare(targetMap, tasks, starts, goals)) {
+            if (mode == MultiAgentMode::Prioritized) {
+                planPrioritized(starts, goals, paths);
+            } else {
+                planConflictBased(starts, goals, paths, result.highLevelNodes);
+            }
+        }
+        finish(paths, result);
+        result.computationTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+        return result;
+    }
+
+    /**
+     * @brief 统计规划结果中的冲突（用于校验）；返回首个冲突
+     * @return bool 存在冲突时返回 true
+     */
+    bool findConflict(const Map& targetMap, const MultiAgentResult& result, Conflict& conflict) {
+        map = &targetMap;
+        width = targetMap.getWidth();
+        height = targetMap.getHeight();
+        std::vector<std::vector<int>> paths(result.paths.size());
+        for (size_t a = 0; a < result.paths.size(); a++) {
+            for (const Point& p : result.paths[a]) {
+                paths[a].push_back(cellOf(p));
+            }
+        }
+        return findFirstConflict(paths, conflict);
+    }
+
+    /**
+     * @brief 获取算法名称
+     */
+    std::string getAlgorithmName() const {
+        return mode == MultiAgentMode::Prioritized ? "Prioritized Space-Time A*" : "Conflict-Based Search";
+    }
+};
+
+#endif // COOPERATIVE_ASTAR_PLANNER_H
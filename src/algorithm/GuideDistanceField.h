@@ -0,0 +1,184 @@
+#ifndef GUIDE_DISTANCE_FIELD_H
+#define GUIDE_DISTANCE_FIELD_H
+
+#include "../../include/Common.h"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief 到引导路径距离的栅格化距离场
+ *
+ * 每次规划构建一次：在给定的若干矩形区域（航点搜索走廊）上以间距 h 的网格节点精确计算
+ * 到引导折线的距离，查询时对所在网格的四个节点做双线性插值，代价为 O(1)，与引导路径段数无关。
+ * 所有区域共用一张网格，区域之间的重叠部分只计算一次，区域外的节点不计算。
+ *
+ * 误差：到折线的距离是 1-Lipschitz 函数，双线性插值是四个节点值的凸组合，
+ * 因此区域内任意点的插值误差不超过 h/√2（在网格中心取到上界）。
+ */
+class GuideDistanceField {
+public:
+    struct Region {
+        double minX, minY, maxX, maxY;
+    };
+
+private:
+    std::vector<double> values;  // 节点距离，行优先（columns × rows），未计算的节点为 -1
+    std::vector<Point> segments; // 合并共线点后的引导折线
+    double originX, originY;     // 区域左下角
+    double spacing;              // 网格间距 h
+    int columns, rows;           // 节点数
+
+public:
+    GuideDistanceField() : originX(0.0), originY(0.0), spacing(1.0), columns(0), rows(0) {}
+
+    /**
+     * @brief 计算点到线段的精确距离
+     */
+    static double segmentDistance(const Point& point, const Point& a, const Point& b) {
+        double cx = b.x - a.x;
+        double cy = b.y - a.y;
+        double lenSq = cx * cx + cy * cy;
+        double t = 0.0;
+        if (lenSq >= 1e-8) {
+            t = std::min(std::max(((point.x - a.x) * cx + (point.y - a.y) * cy) / lenSq, 0.0), 1.0);
+        }
+        double dx = point.x - (a.x + t * cx);
+        double dy = point.y - (a.y + t * cy);
+        return std::sqrt(dx * dx + dy * dy);
+    }
+
+    /**
+     * @brief 计算点到折线的精确距离
+     */
+    static double exactDistance(const std::vector<Point>& polyline, const Point& point) {
+        double best = 99999.0;
+        for (size_t j = 0; j + 1 < polyline.size(); j++) {
+            best = std::min(best, segmentDistance(point, polyline[j], polyline[j + 1]));
+        }
+        return best;
+    }
+
+    /**
+     * @brief 合并折线中的共线点（几何形状不变）
+     * 
+     * A*输出的每个网格一个点，长直线段上大量共线点只会增加距离计算量。
+     */
+    static void removeCollinear(const std::vector<Point>& polyline, std::vector<Point>& out) {
+        out.clear();
+        for (const Point& point : polyline) {
+            if (out.size() >= 2) {
+                const Point& a = out[out.size() - 2];
+                const Point& b = out.back();
+                double cross = (b.x - a.x) * (point.y - b.y) - (b.y - a.y) * (point.x - b.x);
+                double dot = (b.x - a.x) * (point.x - b.x) + (b.y - a.y) * (point.y - b.y);
+                if (std::fabs(cross) < 1e-12 && dot >= 0.0) {
+                    out.back() = point;
+                    continue;
+                }
+            }
+            out.push_back(point);
+        }
+    }
+
+    /**
+     * @brief 在矩形区域上构建距离场
+     * @param polyline 引导路径（至少两个点）
+     * @param minX, minY, maxX, maxY 覆盖区域
+     * @param h 网格间距，决定插值误差上界 h/√2
+     */
+    void build(const std::vector<Point>& polyline, double minX, double minY,
+               double maxX, double maxY, double h) {
+        build(polyline, std::vector<Region>{{minX, minY, maxX, maxY}}, h);
+    }
+
+    /**
+     * @brief 在若干矩形区域的并集上构建距离场
+     * @param polyline 引导路径（至少两个点）
+     * @param regions 覆盖区域（可以相互重叠）
+     * @param h 网格间距，决定插值误差上界 h/√2
+     */
+    void build(const std::vector<Point>& polyline, const std::vector<Region>& regions, double h) {
+        clear();
+        spacing = h;
+        if (regions.empty()) {
+            return;
+        }
+        double minX = regions[0].minX, minY = regions[0].minY;
+        double maxX = regions[0].maxX, maxY = regions[0].maxY;
+        for (const Region& region : regions) {
+            minX = std::min(minX, region.minX);
+            minY = std::min(minY, region.minY);
+            maxX = std::max(maxX, region.maxX);
+            maxY = std::max(maxY, region.maxY);
+        }
+        originX = minX;
+        originY = minY;
+        columns = static_cast<int>(std::ceil((maxX - minX) / h)) + 1;
+        rows = static_cast<int>(std::ceil((maxY - minY) / h)) + 1;
+        values.assign(static_cast<size_t>(columns) * rows, -1.0);
+        removeCollinear(polyline, segments);
+        
+        // 每个区域覆盖与它相交的全部网格（含边界所在网格的外侧节点），保证区域内的查询都能命中
+        for (const Region& region : regions) {
+            int c0 = std::max(0, static_cast<int>(std::floor((region.minX - originX) / h)));
+            int c1 = std::min(columns - 1, static_cast<int>(std::ceil((region.maxX - originX) / h)));
+            int r0 = std::max(0, static_cast<int>(std::floor((region.minY - originY) / h)));
+            int r1 = std::min(rows - 1, static_cast<int>(std::ceil((region.maxY - originY) / h)));
+            for (int r = r0; r <= r1; r++) {
+                for (int c = c0; c <= c1; c++) {
+                    double& value = values[static_cast<size_t>(r) * columns + c];
+                    if (value < 0.0) {
+                        value = exactDistance(segments, Point(originX + c * h, originY + r * h));
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief 清空距离场，此后的查询全部未命中
+     */
+    void clear() {
+        values.clear();
+        columns = rows = 0;
+    }
+
+    /**
+     * @brief 双线性插值查询
+     * @param point 查询点
+     * @param distance 输出的插值距离
+     * @return bool 点位于已计算的网格内返回 true，否则调用者应退回精确计算
+     */
+    bool lookup(const Point& point, double& distance) const {
+        double gx = (point.x - originX) / spacing;
+        double gy = (point.y - originY) / spacing;
+        if (!(gx >= 0.0 && gy >= 0.0 && gx <= columns - 1 && gy <= rows - 1)) {
+            return false;
+        }
+        int c = std::min(static_cast<int>(gx), columns - 2);
+        int r = std::min(static_cast<int>(gy), rows - 2);
+        if (c < 0 || r < 0) {
+            return false;  // 区域退化为单行或单列
+        }
+        double tx = gx - c;
+        double ty = gy - r;
+        const double* row0 = &values[static_cast<size_t>(r) * columns + c];
+        const double* row1 = row0 + columns;
+        if (row0[0] < 0.0 || row0[1] < 0.0 || row1[0] < 0.0 || row1[1] < 0.0) {
+            return false;  // 不在任何区域内
+        }
+        distance = (row0[0] * (1.0 - tx) + row0[1] * tx) * (1.0 - ty) +
+                   (row1[0] * (1.0 - tx) + row1[1] * tx) * ty;
+        return true;
+    }
+
+    /**
+     * @brief 插值误差上界
+     */
+    double tolerance() const {
+        return spacing / std::sqrt(2.0);
+    }
+};
+
+#endif // GUIDE_DISTANCE_FIELD_H
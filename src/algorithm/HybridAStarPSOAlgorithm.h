@@ -4,9 +4,16 @@
 #include "../../include/algorithm/IPathPlanningAlgorithm.h"
 #include "AStarAlgorithm.h"
 #include "ZPSOAlgorithm.h"
+#include "GuideDistanceField.h"
+#include "SegmentCollisionCache.h"
+#include "ConvergenceTrace.h"
+#include "../core/Logger.h"
 #include "../core/Map.h"
+#include "../core/ThreadPool.h"
+#include <atomic>
 #include <chrono>
-#include <iostream>
+#include <cmath>
+#include <mutex>
 
 /**
  * @brief 混合A*和PSO的路径规划算法
@@ -14,28 +21,150 @@
  * 该算法结合了A*算法的全局引导能力和PSO算法的局部优化能力：
  * 1. 首先使用A*算法规划出一条全局引导路径
  * 2. 然后使用PSO算法进行局部优化，引导路径作为适应度函数的一部分
+ *
+ * 算法对象只保存配置，单次规划的状态都在 PlanContext 中，因此同一实例可被多个线程
+ * 同时调用 planPath；setParameter 等配置接口不能与规划并发调用。
  */
 class HybridAStarPSOAlgorithm : public IPathPlanningAlgorithm {
-private:
-    // 算法组件
-    AStarAlgorithm astarSolver;
-    std::unique_ptr<ZPSO_Algorithm> psoSolver;
+protected:
+    // 常驻线程池，跨多次规划复用（由并发的规划共享）
+    std::unique_ptr<ThreadPool> threadPool;
+    std::mutex poolMutex;
     
     // 算法参数
     int particleCount;
     int generations;
-    int numWaypoints;
     double deviationWeight;  // A*引导路径偏离惩罚权重
     double maxSpeed;
     double globalGuideCoe;
     double localGuideCoe;
+    int threadCount;         // 并行评估线程数（1为串行，<=0为硬件并发数）
+    bool batchFitness;       // 是否通过批量回调评估（先解码全部路径再逐条评分，否则逐粒子回调）
+    int stallGenerations;    // 全局最优连续无改进多少代后停止（0为不启用）
+    double improvementThreshold;  // 视为改进的最小相对提升
+    double minSwarmDiameter; // 粒子群直径下限（0为不启用）
+    double targetFitness;    // 达到该适应度即停止（NaN为不启用）
+    bool guidedInit;         // 是否沿A*引导路径初始化粒子
+    double initJitter;       // 引导初始化的高斯扰动标准差（世界坐标）
+    double randomInitFraction;  // 引导初始化时仍均匀随机初始化的粒子比例
+    double corridorMargin;   // 航点搜索走廊相对引导路径包围盒的外扩距离（<=0为整张地图）
+    double distanceFieldResolution;  // 偏离惩罚距离场的网格间距（<=0为逐段精确计算）
+    int collisionCacheSize;  // 线段碰撞缓存槽位数（0为不缓存）
+    bool lazyEvaluation;     // 惰性评估（不可能超过个体最优时跳过昂贵项）
     
-    // 引导路径
-    std::vector<Point> astarGuidePath;
+    // PSO引擎选择
+    bool staticDimension;    // 常用维度使用编译期维度特化的引擎
+    bool useFloat;           // 粒子坐标与速度使用单精度
+    bool asyncMode;          // 异步（稳态）进化：线程间无每代屏障，多线程下结果不可复现
     
-    // 地图和边界信息
-    const Map* currentMap;
-    Point currentStart, currentEnd;
+    // 速度更新参数控制
+    int parameterControl;    // 0：固定，1：线性递减惯性权重，2：收缩因子，3：成功率调整最大速度
+    double inertiaStart;     // 线性递减惯性权重初值
+    double inertiaEnd;       // 线性递减惯性权重终值
+    
+    // 逐代收敛记录容量（0为不记录）
+    int traceCapacity;
+    
+    // 热启动重新规划的最大进化代数（0为与generations相同）
+    int replanGenerations;
+    
+    // 自适应航点数：由化简后引导路径的显著拐点数确定，取代请求中固定的 numWaypoints
+    bool adaptiveWaypoints;
+    int minWaypoints;           // 航点数下限
+    int maxWaypoints;           // 航点数上限
+    double waypointsPerTurn;    // 每个显著拐点分配的航点数
+    double turnAngleThreshold;  // 显著拐点的最小转角（度）
+    
+    // 每代结束后的观察回调（代数、全局最优适应度、全局最优路径）
+    std::function<void(int, double, const std::vector<Point>&)> generationObserver;
+    
+    /**
+     * @brief 单次规划的上下文：请求数据、引导信息、碰撞缓存与工作量统计
+     *
+     * 规划结束后上下文归还空闲列表，下一次规划复用其中的缓冲区；
+     * 并发的规划各自取得独立的上下文。
+     */
+    struct PlanContext {
+        // 请求信息
+        const Map* map = nullptr;
+        Point start, end;
+        int numWaypoints = 0;
+        double deviationWeight = 0.0;  // 本次实际使用的偏离惩罚权重（无引导路径时为0）
+        int generations = 0;           // 本次规划的最大进化代数
+        bool seedCenter = false;       // 初始化中心本身作为一个粒子（热启动时为上一次的最优解）
+        const PlanningProgressCallback* progress = nullptr;  // 本次请求的进度回调（为空则不报告）
+        std::chrono::steady_clock::time_point startTime;
+        
+        // 引导路径
+        AStarAlgorithm astar;
+        std::vector<Point> guidePath;
+        std::vector<double> waypointArcs;  // 各航点在引导路径上的弧长位置（为空则等分引导路径）
+        std::vector<double> guideInitialPosition;  // 引导路径按弧长重采样得到的初始化中心（为空则不引导）
+        GuideDistanceField guideField;  // 各航点走廊并集上的距离场（未启用走廊时为空）
+        
+        // 线段碰撞缓存及其命中统计
+        std::unique_ptr<SegmentCollisionCache> collisionCache;
+        std::atomic<uint64_t> collisionCacheHits{0};
+        std::atomic<uint64_t> collisionCacheMisses{0};
+        
+        // 适应度评估的工作量统计
+        std::atomic<uint64_t> fitnessEvaluations{0};
+        std::atomic<uint64_t> evaluationsCutBeforeDeviation{0};
+        std::atomic<uint64_t> evaluationsCutBeforeCollision{0};
+        std::atomic<uint64_t> segmentChecks{0};
+        std::atomic<uint64_t> cellsTraversed{0};
+        
+        ConvergenceTrace trace;
+    };
+    
+    // 空闲的规划上下文
+    std::vector<std::unique_ptr<PlanContext>> idleContexts;
+    std::mutex contextMutex;
+    
+    // 最近一次完成的规划的引导路径与收敛记录（用于可视化与导出，由 contextMutex 保护）
+    std::vector<Point> lastGuidePath;
+    ConvergenceTrace lastTrace;
+    
+    /**
+     * @brief 取得一个空闲的规划上下文（没有时新建）
+     */
+    std::unique_ptr<PlanContext> acquireContext() {
+        std::lock_guard<std::mutex> lock(contextMutex);
+        if (idleContexts.empty()) {
+            return std::make_unique<PlanContext>();
+        }
+        std::unique_ptr<PlanContext> ctx = std::move(idleContexts.back());
+        idleContexts.pop_back();
+        return ctx;
+    }
+    
+    /**
+     * @brief 归还规划上下文，并把引导路径与收敛记录交换为“最近一次规划”的结果
+     */
+    void releaseContext(std::unique_ptr<PlanContext> ctx) {
+        std::lock_guard<std::mutex> lock(contextMutex);
+        std::swap(lastGuidePath, ctx->guidePath);
+        if (traceCapacity > 0) {
+            std::swap(lastTrace, ctx->trace);
+        } else {
+            lastTrace.reset(0);
+        }
+        idleContexts.push_back(std::move(ctx));
+    }
+    
+    /**
+     * @brief 取得共享的常驻线程池（threadCount为1时返回空指针）
+     */
+    ThreadPool* sharedThreadPool() {
+        if (threadCount == 1) {
+            return nullptr;
+        }
+        std::lock_guard<std::mutex> lock(poolMutex);
+        if (!threadPool || (threadCount > 0 && threadPool->getThreadCount() != threadCount)) {
+            threadPool = std::make_unique<ThreadPool>(threadCount);
+        }
+        return threadPool.get();
+    }
     
     /**
      * @brief 计算点到线段的距离
@@ -73,82 +202,415 @@ private:
         return point.distanceTo(closest);
     }
     
+    /**
+     * @brief 找到折线上离给定点最近的线段
+     * @param path 折线（至少两个点）
+     * @param point 目标点
+     * @return size_t 最近线段的起点下标 i（线段为 path[i] 到 path[i+1]）
+     */
+    size_t nearestSegment(const std::vector<Point>& path, const Point& point) const {
+        size_t nearest = 0;
+        double nearestDistance = INFINITY;
+        for (size_t i = 0; i + 1 < path.size(); i++) {
+            double distance = pointToLineSegmentDistance(point, path[i], path[i+1]);
+            if (distance < nearestDistance) {
+                nearestDistance = distance;
+                nearest = i;
+            }
+        }
+        return nearest;
+    }
+    
+    /**
+     * @brief 由上一次的引导路径修复出从新起点出发的引导路径（增量修复，避免完整A*）
+     * 
+     * 保留离新起点最近线段终点之后的部分；新起点到该点直线可通行时直接连接，
+     * 否则只在这一小段上运行A*。上一次的终点不同，或保留部分经过的网格已变为障碍时返回 false。
+     * @param ctx 规划上下文（start、end、map 已设置）
+     * @param previousGuide 上一次的引导路径
+     * @param checkpoint A*检查点（可为空）
+     * @return bool 修复成功返回 true，结果写入 ctx.guidePath
+     */
+    bool repairGuidePath(PlanContext& ctx, const std::vector<Point>& previousGuide,
+                         const std::function<bool(uint64_t)>& checkpoint) const {
+        ctx.astar.resetStatistics();
+        if (previousGuide.size() < 2 || previousGuide.back().distanceTo(ctx.end) > 1e-9) {
+            return false;
+        }
+        size_t join = nearestSegment(previousGuide, ctx.start) + 1;
+        for (size_t i = join; i < previousGuide.size(); i++) {
+            if (ctx.map->isObstacle(previousGuide[i].x, previousGuide[i].y)) {
+                return false;
+            }
+        }
+        
+        if (ctx.map->isLineColliding(ctx.start, previousGuide[join])) {
+            ctx.guidePath = ctx.astar.findPath(*ctx.map, ctx.start, previousGuide[join], checkpoint);
+            if (ctx.guidePath.empty()) {
+                return false;
+            }
+            ctx.guidePath.pop_back();  // 连接点由保留部分提供
+        } else {
+            ctx.guidePath.assign(1, ctx.start);
+        }
+        ctx.guidePath.insert(ctx.guidePath.end(), previousGuide.begin() + join, previousGuide.end());
+        return true;
+    }
+    
+    /**
+     * @brief 把上一次最优路径在新起点之后的部分整理为 numWaypoints 个航点
+     * 
+     * 保留新起点之后的原有航点（路径形状不变），航点不足时反复在最长的一段中点处补点。
+     * @param ctx 规划上下文（start 已设置）
+     * @param previousPath 上一次的最优路径（含起终点，共 numWaypoints+2 个点）
+     * @param out 输出的粒子位置，长度为 numWaypoints*2
+     */
+    void seedFromPreviousPath(const PlanContext& ctx, const std::vector<Point>& previousPath, double* out) const {
+        std::vector<Point> remaining(1, ctx.start);
+        size_t join = nearestSegment(previousPath, ctx.start) + 1;
+        remaining.insert(remaining.end(), previousPath.begin() + join, previousPath.end());
+        while (remaining.size() < static_cast<size_t>(ctx.numWaypoints) + 2) {
+            size_t longest = 1;
+            for (size_t i = 2; i < remaining.size(); i++) {
+                if (remaining[i-1].distanceTo(remaining[i]) > remaining[longest-1].distanceTo(remaining[longest])) {
+                    longest = i;
+                }
+            }
+            Point middle((remaining[longest-1].x + remaining[longest].x) * 0.5,
+                         (remaining[longest-1].y + remaining[longest].y) * 0.5);
+            remaining.insert(remaining.begin() + longest, middle);
+        }
+        for (int i = 0; i < ctx.numWaypoints; i++) {
+            out[i * 2] = remaining[i + 1].x;
+            out[i * 2 + 1] = remaining[i + 1].y;
+        }
+    }
+    
+    /**
+     * @brief 由引导路径的复杂度确定航点数及各航点在引导路径上的位置
+     * 
+     * 先对引导路径做贪心视线化简（锚点能直接看到下一点时跳过中间点），去掉网格阶梯；
+     * 再统计转角超过 turnAngleThreshold 的拐点，航点数取 拐点数×waypointsPerTurn（向上取整），
+     * 限制在 [minWaypoints, maxWaypoints] 内。航点数不少于拐点数时每个拐点放一个航点
+     * （化简后相邻拐点间视线无遮挡，初始化中心本身即无碰撞），其余航点反复放在最长间隔的中点；
+     * 否则仍等分引导路径。
+     * @param ctx 规划上下文（guidePath 至少两个点），输出 numWaypoints 与 waypointArcs
+     * @return int 显著拐点数
+     */
+    int chooseWaypoints(PlanContext& ctx) const {
+        const std::vector<Point>& astarGuidePath = ctx.guidePath;
+        std::vector<double> arcLength(astarGuidePath.size(), 0.0);
+        for (size_t j = 1; j < astarGuidePath.size(); j++) {
+            arcLength[j] = arcLength[j-1] + astarGuidePath[j-1].distanceTo(astarGuidePath[j]);
+        }
+        std::vector<size_t> simplified(1, 0);  // 化简后保留的引导路径点下标
+        size_t anchor = 0;
+        for (size_t k = 2; k < astarGuidePath.size(); k++) {
+            if (ctx.map->isLineColliding(astarGuidePath[anchor], astarGuidePath[k])) {
+                simplified.push_back(k - 1);
+                anchor = k - 1;
+            }
+        }
+        simplified.push_back(astarGuidePath.size() - 1);
+        
+        const double cosThreshold = std::cos(turnAngleThreshold * Constants::PI / 180.0);
+        std::vector<double> turnArcs;
+        for (size_t i = 1; i + 1 < simplified.size(); i++) {
+            const Point& prev = astarGuidePath[simplified[i-1]];
+            const Point& curr = astarGuidePath[simplified[i]];
+            const Point& next = astarGuidePath[simplified[i+1]];
+            double v1x = curr.x - prev.x, v1y = curr.y - prev.y;
+            double v2x = next.x - curr.x, v2y = next.y - curr.y;
+            double mag = std::sqrt((v1x * v1x + v1y * v1y) * (v2x * v2x + v2y * v2y));
+            if (mag > 1e-12 && (v1x * v2x + v1y * v2y) / mag < cosThreshold) {
+                turnArcs.push_back(arcLength[simplified[i]]);
+            }
+        }
+        
+        int lower = std::max(1, minWaypoints);
+        int upper = std::max(lower, maxWaypoints);
+        int count = static_cast<int>(std::ceil(turnArcs.size() * waypointsPerTurn - 1e-9));
+        ctx.numWaypoints = std::min(std::max(count, lower), upper);
+        
+        ctx.waypointArcs.clear();
+        if (!turnArcs.empty() && turnArcs.size() <= static_cast<size_t>(ctx.numWaypoints)) {
+            // 间隔端点：起点、各拐点、终点；每次在最长的间隔中点插入一个航点
+            std::vector<double> boundaries(1, 0.0);
+            boundaries.insert(boundaries.end(), turnArcs.begin(), turnArcs.end());
+            boundaries.push_back(arcLength.back());
+            while (boundaries.size() < static_cast<size_t>(ctx.numWaypoints) + 2) {
+                size_t longest = 1;
+                for (size_t i = 2; i < boundaries.size(); i++) {
+                    if (boundaries[i] - boundaries[i-1] > boundaries[longest] - boundaries[longest-1]) {
+                        longest = i;
+                    }
+                }
+                boundaries.insert(boundaries.begin() + longest, (boundaries[longest-1] + boundaries[longest]) * 0.5);
+            }
+            ctx.waypointArcs.assign(boundaries.begin() + 1, boundaries.end() - 1);
+        }
+        return static_cast<int>(turnArcs.size());
+    }
+    
+    /**
+     * @brief 第 index 个航点在引导路径上的弧长位置（index 为 -1 与 numWaypoints 时分别对应起点与终点）
+     * 
+     * 未指定航点位置时航点等分引导路径，第 i 个航点位于总弧长的 (i+1)/(numWaypoints+1) 处。
+     */
+    double waypointArc(const PlanContext& ctx, int index, double totalLength) const {
+        if (ctx.waypointArcs.empty()) {
+            return totalLength * (index + 1) / (ctx.numWaypoints + 1);
+        }
+        if (index < 0) {
+            return 0.0;
+        }
+        return index < ctx.numWaypoints ? ctx.waypointArcs[index] : totalLength;
+    }
+    
+    /**
+     * @brief 按弧长将A*引导路径重采样为 numWaypoints 个航点
+     * 
+     * 第 i 个航点位于弧长 waypointArc(i) 处（默认与起点、终点一起把引导路径等分）。
+     * @param ctx 规划上下文
+     * @param out 输出的粒子位置，长度为 numWaypoints*2
+     */
+    void resampleGuidePath(const PlanContext& ctx, double* out) const {
+        const std::vector<Point>& astarGuidePath = ctx.guidePath;
+        const int numWaypoints = ctx.numWaypoints;
+        double totalLength = 0.0;
+        for (size_t j = 1; j < astarGuidePath.size(); j++) {
+            totalLength += astarGuidePath[j-1].distanceTo(astarGuidePath[j]);
+        }
+        
+        size_t segment = 1;
+        double segmentStart = 0.0;  // 当前线段起点处的累计弧长
+        for (int i = 0; i < numWaypoints; i++) {
+            double target = waypointArc(ctx, i, totalLength);
+            while (segment + 1 < astarGuidePath.size() &&
+                   segmentStart + astarGuidePath[segment-1].distanceTo(astarGuidePath[segment]) < target) {
+                segmentStart += astarGuidePath[segment-1].distanceTo(astarGuidePath[segment]);
+                segment++;
+            }
+            const Point& a = astarGuidePath[segment-1];
+            const Point& b = astarGuidePath[segment];
+            double length = a.distanceTo(b);
+            double t = length > 1e-12 ? std::min(std::max((target - segmentStart) / length, 0.0), 1.0) : 0.0;
+            out[i * 2] = a.x + t * (b.x - a.x);
+            out[i * 2 + 1] = a.y + t * (b.y - a.y);
+        }
+    }
+    
+    /**
+     * @brief 由A*引导路径计算每个航点的走廊搜索边界
+     * 
+     * 第 i 个航点对应引导路径弧长区间 [waypointArc(i-1), waypointArc(i+1)]（即相邻两个航点之间的一段；
+     * 默认为 [i/(n+1), (i+2)/(n+1)]），
+     * 取该段引导路径的包围盒并外扩 margin，再裁剪到地图范围内。
+     * @param ctx 规划上下文
+     * @param margin 外扩距离（世界坐标）
+     * @param mapWidth 地图宽度
+     * @param mapHeight 地图高度
+     * @param minBounds 输出的搜索下界，长度为 numWaypoints*2
+     * @param maxBounds 输出的搜索上界，长度为 numWaypoints*2
+     */
+    void computeCorridorBounds(const PlanContext& ctx, double margin, double mapWidth, double mapHeight,
+                               double* minBounds, double* maxBounds) const {
+        const std::vector<Point>& astarGuidePath = ctx.guidePath;
+        const int numWaypoints = ctx.numWaypoints;
+        std::vector<double> arcLength(astarGuidePath.size(), 0.0);
+        for (size_t j = 1; j < astarGuidePath.size(); j++) {
+            arcLength[j] = arcLength[j-1] + astarGuidePath[j-1].distanceTo(astarGuidePath[j]);
+        }
+        const double totalLength = arcLength.back();
+        
+        // 弧长 s 处的引导路径点
+        auto pointAt = [&](double s) {
+            size_t j = 1;
+            while (j + 1 < astarGuidePath.size() && arcLength[j] < s) {
+                j++;
+            }
+            const Point& a = astarGuidePath[j-1];
+            const Point& b = astarGuidePath[j];
+            double length = arcLength[j] - arcLength[j-1];
+            double t = length > 1e-12 ? std::min(std::max((s - arcLength[j-1]) / length, 0.0), 1.0) : 0.0;
+            return Point(a.x + t * (b.x - a.x), a.y + t * (b.y - a.y));
+        };
+        
+        for (int i = 0; i < numWaypoints; i++) {
+            double lo = waypointArc(ctx, i - 1, totalLength);
+            double hi = waypointArc(ctx, i + 1, totalLength);
+            Point a = pointAt(lo);
+            Point b = pointAt(hi);
+            double minX = std::min(a.x, b.x), maxX = std::max(a.x, b.x);
+            double minY = std::min(a.y, b.y), maxY = std::max(a.y, b.y);
+            for (size_t j = 0; j < astarGuidePath.size(); j++) {
+                if (arcLength[j] > lo && arcLength[j] < hi) {
+                    minX = std::min(minX, astarGuidePath[j].x);
+                    maxX = std::max(maxX, astarGuidePath[j].x);
+                    minY = std::min(minY, astarGuidePath[j].y);
+                    maxY = std::max(maxY, astarGuidePath[j].y);
+                }
+            }
+            minBounds[i * 2] = std::max(0.0, minX - margin);
+            maxBounds[i * 2] = std::min(mapWidth, maxX + margin);
+            minBounds[i * 2 + 1] = std::max(0.0, minY - margin);
+            maxBounds[i * 2 + 1] = std::min(mapHeight, maxY + margin);
+        }
+    }
+    
+    /**
+     * @brief 为偏离惩罚构建距离场
+     * 
+     * 每个航点只会落在自己的走廊内，因此只在各航点走廊的并集上构建一张距离场。
+     * 未启用走廊时搜索范围是整张地图，每次规划栅格化整张地图的代价远超过节省的精确计算，
+     * 此时不构建距离场，偏离惩罚直接逐段精确计算。
+     */
+    void buildGuideField(PlanContext& ctx, bool corridorActive, const std::vector<double>& minBounds,
+                         const std::vector<double>& maxBounds) const {
+        if (!corridorActive || distanceFieldResolution <= 0.0 || ctx.guidePath.size() < 2) {
+            ctx.guideField.clear();
+            return;
+        }
+        std::vector<GuideDistanceField::Region> regions(ctx.numWaypoints);
+        for (int i = 0; i < ctx.numWaypoints; i++) {
+            regions[i] = {minBounds[i * 2], minBounds[i * 2 + 1], maxBounds[i * 2], maxBounds[i * 2 + 1]};
+        }
+        ctx.guideField.build(ctx.guidePath, regions, distanceFieldResolution);
+    }
+    
+    /**
+     * @brief 航点到A*引导路径的距离（优先查距离场，未命中时逐段精确计算）
+     * @param ctx 规划上下文
+     * @param waypoint 航点
+     */
+    double guideDeviation(const PlanContext& ctx, const Point& waypoint) const {
+        double distance;
+        if (ctx.guideField.lookup(waypoint, distance)) {
+            return distance;
+        }
+        double minDistanceToGuidePath = 99999.0;
+        for (size_t j = 0; j < ctx.guidePath.size() - 1; ++j) {
+            double dist = pointToLineSegmentDistance(waypoint, ctx.guidePath[j], ctx.guidePath[j+1]);
+            if (dist < minDistanceToGuidePath) {
+                minDistanceToGuidePath = dist;
+            }
+        }
+        return minDistanceToGuidePath;
+    }
+    
     /**
      * @brief 将PSO粒子解码为路径
+     * @param ctx 规划上下文
      * @param particle PSO粒子
      * @return std::vector<Point> 解码后的路径
      */
-    std::vector<Point> decodePath(const ZPSO_Partical& particle) const {
+    std::vector<Point> decodePath(const PlanContext& ctx, const ZPSO_Partical& particle) const {
         std::vector<Point> path;
-        path.push_back(currentStart);
+        path.push_back(ctx.start);
         
         // 添加中间航点
-        for (int i = 0; i < numWaypoints; i++) {
+        for (int i = 0; i < ctx.numWaypoints; i++) {
             Point waypoint(particle._position[i * 2], particle._position[i * 2 + 1]);
             path.push_back(waypoint);
         }
         
-        path.push_back(currentEnd);
+        path.push_back(ctx.end);
         return path;
     }
     
     /**
-     * @brief PSO适应度函数（包含A*引导）
-     * @param particle PSO粒子
-     * @return double 适应度值（越高越好）
+     * @brief 将一个粒子的位置向量解码到给定缓冲区（起点 + 航点 + 终点）
+     * @param position 粒子位置，长度为 numWaypoints*2（单精度或双精度）
+     * @param out 输出缓冲区，长度至少为 numWaypoints+2
      */
-    double evaluateFitness(ZPSO_Partical& particle) {
-        double fitness = 1000.0;  // 基础适应度
-        
-        // 解码粒子为路径
-        std::vector<Point> path = decodePath(particle);
+    template <typename Real>
+    static void decodePathInto(const PlanContext& ctx, const Real* position, Point* out) {
+        out[0] = ctx.start;
+        for (int i = 0; i < ctx.numWaypoints; i++) {
+            out[i + 1] = Point(position[i * 2], position[i * 2 + 1]);
+        }
+        out[ctx.numWaypoints + 1] = ctx.end;
+    }
+    
+    /**
+     * @brief 适应度评估的工作量计数（先在本地累计，再一次性并入共享计数器）
+     */
+    struct WorkCounters {
+        uint64_t evaluations = 0;         // 适应度评估次数
+        uint64_t cutBeforeDeviation = 0;  // 跳过偏离惩罚与碰撞检测的次数
+        uint64_t cutBeforeCollision = 0;  // 仅跳过碰撞检测的次数
+        uint64_t segmentChecks = 0;       // 线段碰撞检测次数
+        uint64_t cellsTraversed = 0;      // 碰撞检测遍历的网格数
+    };
+    
+    /**
+     * @brief 统计路径中与障碍物碰撞的线段数（启用缓存时复用已检测过的线段结果）
+     */
+    static int countCollisions(PlanContext& ctx, const Point* path, size_t pathSize, WorkCounters& counters) {
+        int collisions = 0;
+        counters.segmentChecks += pathSize - 1;
+        if (!ctx.collisionCache) {
+            for (size_t i = 1; i < pathSize; i++) {
+                if (ctx.map->isLineColliding(path[i-1], path[i], counters.cellsTraversed)) {
+                    collisions++;
+                }
+            }
+            return collisions;
+        }
         
-        // 1. 碰撞惩罚
-        double collisionPenalty = 0.0;
-        for (size_t i = 1; i < path.size(); i++) {
-            if (currentMap->isLineColliding(path[i-1], path[i])) {
-                collisionPenalty += 500.0;  // 严重惩罚碰撞
+        uint64_t hits = 0;
+        for (size_t i = 1; i < pathSize; i++) {
+            bool hit;
+            if (ctx.collisionCache->isLineColliding(*ctx.map, path[i-1], path[i], hit, counters.cellsTraversed)) {
+                collisions++;
             }
+            hits += hit ? 1 : 0;
         }
+        // 每条路径只更新一次共享计数器
+        ctx.collisionCacheHits.fetch_add(hits, std::memory_order_relaxed);
+        ctx.collisionCacheMisses.fetch_add(pathSize - 1 - hits, std::memory_order_relaxed);
+        return collisions;
+    }
+    
+    
+    /**
+     * @brief 根据已解码路径惰性计算适应度
+     * 
+     * 先计算代价低的边界、长度、平滑度三项，假设偏离与碰撞惩罚为0得到适应度上界；
+     * 上界不超过 bound 时直接返回上界，否则补上偏离惩罚再比较一次，最后才做碰撞检测。
+     * 浮点加减对每个操作数单调，上界一定不小于真实适应度；返回值 <= bound 时
+     * 粒子的个体最优（严格大于才更新）不会改变。三项全部计算时结果与完整公式逐位一致。
+     * 
+     * @param ctx 规划上下文
+     * @param path 解码后的路径
+     * @param pathSize 路径点数
+     * @param bound 只有超过该值的适应度才有意义（粒子的个体最优），-inf表示完整计算
+     * @param counters 工作量计数
+     * @return double 适应度值（越高越好），或不超过 bound 的上界
+     */
+    double scorePath(PlanContext& ctx, const Point* path, size_t pathSize, double bound, WorkCounters& counters) const {
+        double fitness = 1000.0;  // 基础适应度
+        counters.evaluations++;
         
-        // 2. 边界惩罚
+        // 1. 边界惩罚
         double boundaryPenalty = 0.0;
-        for (size_t i = 1; i < path.size() - 1; i++) {  // 不检查起点和终点
-            if (!currentMap->isInBounds(path[i].x, path[i].y)) {
+        for (size_t i = 1; i < pathSize - 1; i++) {  // 不检查起点和终点
+            if (!ctx.map->isInBounds(path[i].x, path[i].y)) {
                 boundaryPenalty += 300.0;
             }
         }
         
-        // 3. 路径长度惩罚
+        // 2. 路径长度惩罚
         double pathLength = 0.0;
-        for (size_t i = 1; i < path.size(); i++) {
+        for (size_t i = 1; i < pathSize; i++) {
             pathLength += path[i-1].distanceTo(path[i]);
         }
         double lengthPenalty = pathLength * 0.5;  // 较轻的长度惩罚
         
-        // 4. A*引导路径偏离惩罚（核心创新）
-        double deviationPenalty = 0.0;
-        if (!astarGuidePath.empty()) {
-            // 遍历PSO路径上的每一个中间航点
-            for (size_t i = 1; i < path.size() - 1; ++i) {
-                const Point& waypoint = path[i];
-                double minDistanceToGuidePath = 99999.0;
-                
-                // 找到这个航点到A*引导路径的最短距离
-                for (size_t j = 0; j < astarGuidePath.size() - 1; ++j) {
-                    double dist = pointToLineSegmentDistance(waypoint, astarGuidePath[j], astarGuidePath[j+1]);
-                    if (dist < minDistanceToGuidePath) {
-                        minDistanceToGuidePath = dist;
-                    }
-                }
-                deviationPenalty += minDistanceToGuidePath;
-            }
-        }
-        
-        // 5. 路径平滑度奖励
+        // 3. 路径平滑度奖励
         double smoothnessBonus = 0.0;
-        if (path.size() >= 3) {
-            for (size_t i = 1; i < path.size() - 1; i++) {
+        if (pathSize >= 3) {
+            for (size_t i = 1; i < pathSize - 1; i++) {
                 Point prev = path[i-1];
                 Point curr = path[i];
                 Point next = path[i+1];
@@ -168,59 +630,367 @@ private:
             }
         }
         
+        double upperBound = fitness - boundaryPenalty - lengthPenalty + smoothnessBonus;
+        if (upperBound <= bound) {
+            counters.cutBeforeDeviation++;
+            return upperBound;
+        }
+        
+        // 4. A*引导路径偏离惩罚（核心创新）
+        double deviationPenalty = 0.0;
+        if (!ctx.guidePath.empty()) {
+            // 遍历PSO路径上的每一个中间航点，累加其到A*引导路径的最短距离
+            for (size_t i = 1; i < pathSize - 1; ++i) {
+                deviationPenalty += guideDeviation(ctx, path[i]);
+            }
+        }
+        
+        upperBound = fitness - boundaryPenalty - lengthPenalty - deviationPenalty * ctx.deviationWeight + smoothnessBonus;
+        if (upperBound <= bound) {
+            counters.cutBeforeCollision++;
+            return upperBound;
+        }
+        
+        // 5. 碰撞惩罚
+        double collisionPenalty = 500.0 * countCollisions(ctx, path, pathSize, counters);  // 严重惩罚碰撞
+        
         // 计算最终适应度
         fitness = fitness - collisionPenalty - boundaryPenalty - lengthPenalty 
-                 - deviationPenalty * deviationWeight + smoothnessBonus;
+                 - deviationPenalty * ctx.deviationWeight + smoothnessBonus;
         
         return fitness;
     }
+    
+    /**
+     * @brief 惰性评估的下限：启用时为粒子的个体最优，否则为-inf（完整计算）
+     */
+    double lazyBound(const PlanContext& ctx, double personalBest) const {
+        return (lazyEvaluation && ctx.deviationWeight >= 0.0) ? personalBest : -INFINITY;
+    }
+    
+    /**
+     * @brief 将本地计数并入本次规划的共享计数器
+     */
+    static void flushWorkCounters(PlanContext& ctx, const WorkCounters& counters) {
+        ctx.fitnessEvaluations.fetch_add(counters.evaluations, std::memory_order_relaxed);
+        ctx.evaluationsCutBeforeDeviation.fetch_add(counters.cutBeforeDeviation, std::memory_order_relaxed);
+        ctx.evaluationsCutBeforeCollision.fetch_add(counters.cutBeforeCollision, std::memory_order_relaxed);
+        ctx.segmentChecks.fetch_add(counters.segmentChecks, std::memory_order_relaxed);
+        ctx.cellsTraversed.fetch_add(counters.cellsTraversed, std::memory_order_relaxed);
+    }
+    
+    /**
+     * @brief 获取当前线程的路径解码缓冲区
+     * 
+     * 缓冲区为线程局部且只增不减，预热后适应度评估不再分配堆内存。
+     * @param pointCount 需要的路径点数
+     */
+    static Point* scratchPathBuffer(size_t pointCount) {
+        static thread_local std::vector<Point> pathBuffer;
+        if (pathBuffer.size() < pointCount) {
+            pathBuffer.resize(pointCount);
+        }
+        return pathBuffer.data();
+    }
+    
+    /**
+     * @brief PSO适应度函数（包含A*引导），逐粒子版本
+     * @param ctx 规划上下文
+     * @param particle PSO粒子
+     * @return double 适应度值（越高越好）
+     */
+    template <typename ParticalType>
+    double evaluateFitness(PlanContext& ctx, ParticalType& particle) const {
+        // 解码粒子为路径
+        const size_t pathSize = static_cast<size_t>(ctx.numWaypoints) + 2;
+        Point* path = scratchPathBuffer(pathSize);
+        decodePathInto(ctx, particle._position.data(), path);
+        WorkCounters counters;
+        double fitness = scorePath(ctx, path, pathSize, lazyBound(ctx, particle._bestFitness), counters);
+        flushWorkCounters(ctx, counters);
+        return fitness;
+    }
+    
+    /**
+     * @brief PSO适应度函数的批量版本
+     * 
+     * 只是逐粒子评估的批量适配：先一次性解码全部粒子的路径，再对每条路径调用与逐粒子版本相同的
+     * scorePath（碰撞检测仍在各条路径内部进行，没有跨粒子的批量碰撞检测），结果与逐粒子版本逐位一致。
+     * 与逐粒子回调相比只省去每个粒子一次的 std::function 调用与工作量计数的原子累加。
+     * 
+     * @param ctx 规划上下文
+     * @param positions 位置矩阵（count×dimension，行优先）
+     * @param bestFitness 各粒子的个体最优适应度（惰性评估的下限）
+     * @param count 粒子数
+     * @param dimension 维度（numWaypoints*2）
+     * @param fitness 输出的适应度数组
+     */
+    template <typename Real>
+    void evaluateFitnessBatch(PlanContext& ctx, const Real* positions, const double* bestFitness, int count,
+                              int dimension, double* fitness) const {
+        const size_t pathSize = static_cast<size_t>(ctx.numWaypoints) + 2;
+        Point* pathBuffer = scratchPathBuffer(pathSize * count);
+        
+        // 1. 解码全部路径
+        for (int p = 0; p < count; p++) {
+            decodePathInto(ctx, positions + static_cast<size_t>(p) * dimension, &pathBuffer[p * pathSize]);
+        }
+        
+        // 2. 逐条路径惰性计算
+        WorkCounters counters;
+        for (int p = 0; p < count; p++) {
+            fitness[p] = scorePath(ctx, &pathBuffer[p * pathSize], pathSize, lazyBound(ctx, bestFitness[p]), counters);
+        }
+        flushWorkCounters(ctx, counters);
+    }
 
-public:
     /**
-     * @brief 构造函数
+     * @brief 将PSO终止原因映射为通用终止原因
      */
-    HybridAStarPSOAlgorithm() 
-        : particleCount(50), generations(100), numWaypoints(5), 
-          deviationWeight(5.0), maxSpeed(1.0), globalGuideCoe(2.0), 
-          localGuideCoe(2.0), currentMap(nullptr) {}
+    static TerminationReason toTerminationReason(ZPSO_StopReason reason) {
+        switch (reason) {
+            case ZPSO_StopReason::Stalled:        return TerminationReason::Stalled;
+            case ZPSO_StopReason::SwarmCollapsed: return TerminationReason::SwarmCollapsed;
+            case ZPSO_StopReason::Deadline:       return TerminationReason::TimeLimit;
+            case ZPSO_StopReason::TargetReached:  return TerminationReason::TargetReached;
+            case ZPSO_StopReason::Cancelled:      return TerminationReason::Cancelled;
+            default:                              return TerminationReason::Completed;
+        }
+    }
     
     /**
-     * @brief 析构函数
+     * @brief 向请求的进度回调报告当前进度
      */
-    virtual ~HybridAStarPSOAlgorithm() = default;
+    void reportProgress(const PlanContext& ctx, PlanningStage stage, int generation, double bestFitness) const {
+        PlanningProgress progress;
+        progress.stage = stage;
+        progress.nodesExpanded = ctx.astar.getNodesExpanded();
+        progress.generation = generation;
+        progress.maxGenerations = ctx.generations;
+        progress.bestFitness = bestFitness;
+        progress.elapsedTime = ZPSO_Algorithm::elapsedNs(ctx.startTime) / 1e9;
+        (*ctx.progress)(progress);
+    }
     
     /**
-     * @brief 执行混合路径规划
-     * @param request 路径规划请求
-     * @return PathPlanningResult 规划结果
+     * @brief PSO阶段的运行结果
      */
-    virtual PathPlanningResult planPath(const PathPlanningRequest& request) override {
-        auto startTime = std::chrono::high_resolution_clock::now();
+    struct SwarmOutcome {
+        int generationsUsed;
+        ZPSO_StopReason stopReason;
+        int64_t evolutionNs;  // 初始化之后进化阶段的耗时（纳秒）
+    };
+    
+    /**
+     * @brief 创建一个使用本算法适应度函数的PSO求解器（不含线程池与终止条件）
+     * @tparam D 编译期维度（0为运行时维度）
+     * @tparam Real 粒子坐标精度
+     * @param ctx 规划上下文（须在求解器使用期间保持有效）
+     * @param minBounds 搜索下界
+     * @param maxBounds 搜索上界
+     * @param swarmSize 粒子数
+     * @param seed 随机种子
+     */
+    template <int D = 0, typename Real = double>
+    std::unique_ptr<ZPSO_AlgorithmT<D, Real>> createSwarm(PlanContext& ctx,
+                                                          const std::vector<double>& minBounds,
+                                                          const std::vector<double>& maxBounds,
+                                                          int swarmSize, uint64_t seed) const {
+        using Swarm = ZPSO_AlgorithmT<D, Real>;
+        
+        // 创建适应度函数
+        auto fitnessFunc = [this, &ctx](typename Swarm::Partical& p) -> double {
+            return this->evaluateFitness(ctx, p);
+        };
+        
+        // 创建PSO求解器
+        auto swarm = std::make_unique<Swarm>(
+            fitnessFunc,
+            minBounds.data(),
+            maxBounds.data(),
+            static_cast<int>(minBounds.size()),
+            swarmSize,
+            globalGuideCoe,
+            localGuideCoe,
+            maxSpeed,
+            seed
+        );
+        if (batchFitness) {
+            swarm->setBatchFitnessFunction(
+                [this, &ctx](const Real* positions, const double* bestFitness, int count, int dim, double* fitness) {
+                    this->evaluateFitnessBatch(ctx, positions, bestFitness, count, dim, fitness);
+                });
+        }
+        if (!ctx.guideInitialPosition.empty()) {
+            swarm->setInitialGuide(ctx.guideInitialPosition.data(), initJitter, randomInitFraction, ctx.seedCenter);
+        }
+        ZPSO_ParameterSchedule schedule;
+        schedule.mode = static_cast<ZPSO_ParameterControl>(parameterControl);
+        schedule.inertiaStart = inertiaStart;
+        schedule.inertiaEnd = inertiaEnd;
+        swarm->setParameterSchedule(schedule);
+        return swarm;
+    }
+    
+    /**
+     * @brief 运行PSO优化阶段（派生类可替换为其他粒子群组织方式）
+     * @param ctx 规划上下文
+     * @param minBounds 搜索下界
+     * @param maxBounds 搜索上界
+     * @param stopCriteria 提前终止条件
+     * @param seed 随机种子
+     * @param bestParticle 输出的最优粒子
+     * @return SwarmOutcome 实际进化代数与终止原因
+     */
+    virtual SwarmOutcome optimize(PlanContext& ctx,
+                                  const std::vector<double>& minBounds,
+                                  const std::vector<double>& maxBounds,
+                                  const ZPSO_StopCriteria& stopCriteria,
+                                  uint64_t seed, ZPSO_Partical& bestParticle) {
+        if (useFloat) {
+            return dispatchDimension<float>(ctx, minBounds, maxBounds, stopCriteria, seed, bestParticle);
+        }
+        return dispatchDimension<double>(ctx, minBounds, maxBounds, stopCriteria, seed, bestParticle);
+    }
+    
+    /**
+     * @brief 按维度选择编译期特化的PSO引擎，常用维度之外退回运行时维度引擎
+     * 
+     * 维度为 numWaypoints*2；双精度下特化引擎与运行时维度引擎的结果逐位一致。
+     */
+    template <typename Real>
+    SwarmOutcome dispatchDimension(PlanContext& ctx,
+                                   const std::vector<double>& minBounds,
+                                   const std::vector<double>& maxBounds,
+                                   const ZPSO_StopCriteria& stopCriteria,
+                                   uint64_t seed, ZPSO_Partical& bestParticle) {
+        if (staticDimension) {
+            switch (minBounds.size()) {
+                case 4:  return runSwarm<4, Real>(ctx, minBounds, maxBounds, stopCriteria, seed, bestParticle);
+                case 6:  return runSwarm<6, Real>(ctx, minBounds, maxBounds, stopCriteria, seed, bestParticle);
+                case 8:  return runSwarm<8, Real>(ctx, minBounds, maxBounds, stopCriteria, seed, bestParticle);
+                case 10: return runSwarm<10, Real>(ctx, minBounds, maxBounds, stopCriteria, seed, bestParticle);
+                case 12: return runSwarm<12, Real>(ctx, minBounds, maxBounds, stopCriteria, seed, bestParticle);
+                case 16: return runSwarm<16, Real>(ctx, minBounds, maxBounds, stopCriteria, seed, bestParticle);
+                case 20: return runSwarm<20, Real>(ctx, minBounds, maxBounds, stopCriteria, seed, bestParticle);
+                default: break;
+            }
+        }
+        return runSwarm<0, Real>(ctx, minBounds, maxBounds, stopCriteria, seed, bestParticle);
+    }
+    
+    /**
+     * @brief 以指定维度与精度的PSO引擎运行优化
+     */
+    template <int D, typename Real>
+    SwarmOutcome runSwarm(PlanContext& ctx,
+                          const std::vector<double>& minBounds,
+                          const std::vector<double>& maxBounds,
+                          const ZPSO_StopCriteria& stopCriteria,
+                          uint64_t seed, ZPSO_Partical& bestParticle) {
+        auto swarm = createSwarm<D, Real>(ctx, minBounds, maxBounds, particleCount, seed);
+        
+        // 常驻线程池用于并行评估粒子适应度；被其他规划占用时该并行区在本线程串行执行
+        swarm->setThreadPool(sharedThreadPool());
+        
+        swarm->setStopCriteria(stopCriteria);
+        ctx.trace.clear();
+        if (traceCapacity > 0) {
+            if (ctx.trace.capacity() != static_cast<size_t>(traceCapacity)) {
+                ctx.trace.reset(traceCapacity);
+            }
+            swarm->setTrace(&ctx.trace);
+        }
+        if (generationObserver || ctx.progress) {
+            swarm->setGenerationObserver([this, &ctx](int generation, const typename ZPSO_AlgorithmT<D, Real>::Partical& globalBest) {
+                if (ctx.progress) {
+                    reportProgress(ctx, PlanningStage::Optimize, generation, globalBest._bestFitness);
+                }
+                if (generationObserver) {
+                    std::vector<Point> path(ctx.numWaypoints + 2);
+                    decodePathInto(ctx, globalBest._bestPosition.data(), path.data());
+                    generationObserver(generation, globalBest._bestFitness, path);
+                }
+            });
+        }
+        typename ZPSO_AlgorithmT<D, Real>::Partical best(static_cast<int>(minBounds.size()));
+        if (asyncMode) {
+            swarm->findMaxAsync(ctx.generations, best);
+        } else {
+            swarm->findMax(ctx.generations, best);
+        }
+        bestParticle.copyFrom(best);
+        return {swarm->_generationsUsed, swarm->_stopReason, swarm->_evolutionNs};
+    }
+
+    /**
+     * @brief 在给定上下文中执行一次规划（上下文由调用者独占）
+     * @param previous 热启动时为上一次的规划结果，否则为空
+     */
+    PathPlanningResult planWithContext(PlanContext& ctx, const PathPlanningRequest& request,
+                                       const PathPlanningResult* previous = nullptr) {
+        auto startTime = std::chrono::steady_clock::now();
         
         // 保存当前请求信息
-        currentMap = request.map;
-        currentStart = request.startPoint;
-        currentEnd = request.endPoint;
-        numWaypoints = request.numWaypoints;
+        ctx.map = request.map;
+        ctx.start = request.startPoint;
+        ctx.end = request.endPoint;
+        ctx.numWaypoints = request.numWaypoints;
+        ctx.waypointArcs.clear();
+        ctx.progress = request.progress ? &request.progress : nullptr;
+        ctx.startTime = startTime;
+        const CancellationToken* cancellation = request.cancellation;
+        const Map* currentMap = ctx.map;
         
-        std::cout << "开始混合A*-PSO路径规划..." << std::endl;
+        // 热启动：上一次的最优路径与本次终点、航点数一致时复用（自适应航点数时沿用上一次的航点数）
+        const bool warmStart = previous != nullptr && previous->path.size() >= 3 &&
+                               (adaptiveWaypoints ||
+                                previous->path.size() == static_cast<size_t>(ctx.numWaypoints) + 2) &&
+                               previous->path.back().distanceTo(ctx.end) <= 1e-9;
+        if (warmStart) {
+            ctx.numWaypoints = static_cast<int>(previous->path.size()) - 2;
+        }
+        ctx.generations = (warmStart && replanGenerations > 0) ? replanGenerations : generations;
         
-        // 第一阶段：使用A*算法生成全局引导路径
-        std::cout << "阶段1: 执行A*算法生成引导路径..." << std::endl;
-        astarGuidePath = astarSolver.findPath(*currentMap, currentStart, currentEnd);
+        LOG_INFO("开始混合A*-PSO路径规划...");
+        
+        // 第一阶段：使用A*算法生成全局引导路径（每批节点扩展后检查取消并报告进度）
+        LOG_INFO("阶段1: 执行A*算法生成引导路径...");
+        std::function<bool(uint64_t)> checkpoint;
+        if (cancellation || ctx.progress) {
+            checkpoint = [this, &ctx, cancellation](uint64_t) {
+                if (ctx.progress) {
+                    reportProgress(ctx, PlanningStage::Guide, 0, -INFINITY);
+                }
+                return !(cancellation && cancellation->isCancelled());
+            };
+        }
+        if (previous != nullptr && repairGuidePath(ctx, previous->guidePath, checkpoint)) {
+            LOG_INFO("复用上一次的引导路径（局部A*扩展 " << ctx.astar.getNodesExpanded() << " 个节点）");
+        } else {
+            ctx.guidePath = ctx.astar.findPath(*currentMap, ctx.start, ctx.end, checkpoint);
+        }
         
-        if (astarGuidePath.empty()) {
-            std::cout << "警告: A*未能找到全局路径！PSO将在无引导下运行。" << std::endl;
-            deviationWeight = 0.0;  // 无引导路径时不使用偏离惩罚
+        if (ctx.astar.wasAborted()) {
+            LOG_INFO("A*搜索已取消");
+            ctx.deviationWeight = 0.0;
+        } else if (ctx.guidePath.empty()) {
+            LOG_WARN("A*未能找到全局路径！PSO将在无引导下运行。");
+            ctx.deviationWeight = 0.0;  // 无引导路径时本次规划不使用偏离惩罚
         } else {
-            std::cout << "A*引导路径包含 " << astarGuidePath.size() << " 个点" << std::endl;
+            ctx.deviationWeight = deviationWeight;
+            LOG_INFO("A*引导路径包含 " << ctx.guidePath.size() << " 个点");
+            if (adaptiveWaypoints && !warmStart) {
+                int significantTurns = chooseWaypoints(ctx);
+                LOG_INFO("自适应航点数: " << ctx.numWaypoints << "（显著拐点 " << significantTurns << " 个）");
+            }
         }
         
         // 第二阶段：使用PSO算法优化路径
-        std::cout << "阶段2: 执行PSO算法优化路径..." << std::endl;
+        LOG_INFO("阶段2: 执行PSO算法优化路径...");
         
         // 设置PSO搜索边界
-        int dimension = numWaypoints * 2;  // 每个航点有x,y坐标
+        int dimension = ctx.numWaypoints * 2;  // 每个航点有x,y坐标
         std::vector<double> minBounds(dimension);
         std::vector<double> maxBounds(dimension);
         
@@ -232,33 +1002,66 @@ public:
             maxBounds[i] = (i % 2 == 0) ? mapWidth : mapHeight;
         }
         
-        // 创建适应度函数
-        auto fitnessFunc = [this](ZPSO_Partical& p) -> double {
-            return this->evaluateFitness(p);
-        };
+        // 走廊边界：每个航点只在引导路径对应弧段附近搜索
+        const bool corridorActive = corridorMargin > 0.0 && ctx.guidePath.size() >= 2;
+        if (corridorActive) {
+            computeCorridorBounds(ctx, corridorMargin, mapWidth, mapHeight, minBounds.data(), maxBounds.data());
+        }
         
-        // 创建PSO求解器
-        psoSolver = std::make_unique<ZPSO_Algorithm>(
-            fitnessFunc,
-            minBounds.data(),
-            maxBounds.data(),
-            dimension,
-            particleCount,
-            globalGuideCoe,
-            localGuideCoe,
-            maxSpeed
-        );
+        // 在走廊上预先栅格化到引导路径的距离
+        buildGuideField(ctx, corridorActive, minBounds, maxBounds);
+        
+        // 每次规划清空线段碰撞缓存（槽位数组只在容量变化时重新分配）
+        if (collisionCacheSize <= 0) {
+            ctx.collisionCache.reset();
+        } else if (!ctx.collisionCache || ctx.collisionCache->capacity() < static_cast<size_t>(collisionCacheSize)) {
+            ctx.collisionCache = std::make_unique<SegmentCollisionCache>(collisionCacheSize);
+        }
+        if (ctx.collisionCache) {
+            ctx.collisionCache->reset(currentMap->getCellSize());
+        }
+        ctx.collisionCacheHits.store(0, std::memory_order_relaxed);
+        ctx.collisionCacheMisses.store(0, std::memory_order_relaxed);
+        ctx.fitnessEvaluations.store(0, std::memory_order_relaxed);
+        ctx.evaluationsCutBeforeDeviation.store(0, std::memory_order_relaxed);
+        ctx.evaluationsCutBeforeCollision.store(0, std::memory_order_relaxed);
+        ctx.segmentChecks.store(0, std::memory_order_relaxed);
+        ctx.cellsTraversed.store(0, std::memory_order_relaxed);
+        
+        // 引导初始化：大部分粒子围绕重采样后的A*引导路径生成；
+        // 热启动时改为围绕上一次最优路径的剩余部分生成，并保留该路径本身作为一个粒子
+        ctx.guideInitialPosition.clear();
+        ctx.seedCenter = warmStart;
+        if (warmStart) {
+            ctx.guideInitialPosition.resize(dimension);
+            seedFromPreviousPath(ctx, previous->path, ctx.guideInitialPosition.data());
+        } else if (guidedInit && ctx.guidePath.size() >= 2) {
+            ctx.guideInitialPosition.resize(dimension);
+            resampleGuidePath(ctx, ctx.guideInitialPosition.data());
+        }
+        // 引导阶段：A*、走廊边界、距离场与引导初始化的重采样
+        int64_t guideNs = ZPSO_Algorithm::elapsedNs(startTime);
+        
+        // 设置提前终止条件，maxTime从规划开始计时（含A*阶段）
+        ZPSO_StopCriteria stopCriteria;
+        stopCriteria.stallGenerations = stallGenerations;
+        stopCriteria.minRelativeImprovement = improvementThreshold;
+        stopCriteria.minSwarmDiameter = minSwarmDiameter;
+        stopCriteria.setTimeBudget(startTime, request.maxTime);
+        stopCriteria.useTargetFitness = !std::isnan(targetFitness);
+        stopCriteria.targetFitness = targetFitness;
+        // 取消后在下一代开始前停止：已取消时只完成初始种群评估，返回其中的最优路径
+        stopCriteria.cancelFlag = cancellation ? &cancellation->flag() : nullptr;
         
         // 运行PSO优化
         ZPSO_Partical bestParticle(dimension);
-        psoSolver->findMax(generations, bestParticle);
+        auto optimizeStart = std::chrono::steady_clock::now();
+        SwarmOutcome outcome = optimize(ctx, minBounds, maxBounds, stopCriteria, request.randomSeed, bestParticle);
+        int64_t optimizeNs = ZPSO_Algorithm::elapsedNs(optimizeStart);
         
         // 构建最终结果
-        std::vector<Point> finalPath = decodePath(bestParticle);
-        
-        auto endTime = std::chrono::high_resolution_clock::now();
-        auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
-        double computationTime = duration.count() / 1000.0;
+        auto validationStart = std::chrono::steady_clock::now();
+        std::vector<Point> finalPath = decodePath(ctx, bestParticle);
         
         // 计算路径长度
         double pathLength = 0.0;
@@ -268,24 +1071,106 @@ public:
         
         // 检查路径是否有效（无碰撞）
         bool success = true;
+        uint64_t validationCells = 0;
+        size_t validationSegments = 0;
         for (size_t i = 1; i < finalPath.size(); i++) {
-            if (currentMap->isLineColliding(finalPath[i-1], finalPath[i])) {
+            validationSegments++;
+            if (currentMap->isLineColliding(finalPath[i-1], finalPath[i], validationCells)) {
                 success = false;
                 break;
             }
         }
+        int64_t validationNs = ZPSO_Algorithm::elapsedNs(validationStart);
+        int64_t totalNs = ZPSO_Algorithm::elapsedNs(startTime);
+        double computationTime = totalNs / 1e9;
         
-        std::cout << "混合算法完成! 用时: " << computationTime << "秒" << std::endl;
-        std::cout << "路径长度: " << pathLength << ", 成功: " << (success ? "是" : "否") << std::endl;
+        LOG_INFO("混合算法完成! 用时: " << computationTime << "秒");
+        LOG_INFO("路径长度: " << pathLength << ", 成功: " << (success ? "是" : "否"));
+        LOG_INFO("PSO进化代数: " << outcome.generationsUsed << "/" << ctx.generations
+                 << ", 终止原因: " << terminationReasonName(toTerminationReason(outcome.stopReason)));
         
-        return PathPlanningResult(
+        PathPlanningResult result(
             finalPath,
             pathLength,
             bestParticle._bestFitness,
             success,
             computationTime,
-            "Hybrid A*-PSO"
+            getAlgorithmName()
         );
+        result.guidePath = ctx.guidePath;
+        result.iterations = outcome.generationsUsed;
+        result.terminationReason = toTerminationReason(outcome.stopReason);
+        result.stats.collisionCacheHits = ctx.collisionCacheHits.load(std::memory_order_relaxed);
+        result.stats.collisionCacheMisses = ctx.collisionCacheMisses.load(std::memory_order_relaxed);
+        result.stats.fitnessEvaluations = ctx.fitnessEvaluations.load(std::memory_order_relaxed);
+        result.stats.evaluationsCutBeforeDeviation = ctx.evaluationsCutBeforeDeviation.load(std::memory_order_relaxed);
+        result.stats.evaluationsCutBeforeCollision = ctx.evaluationsCutBeforeCollision.load(std::memory_order_relaxed);
+        result.stats.nodesExpanded = ctx.astar.getNodesExpanded();
+        result.stats.segmentChecks = ctx.segmentChecks.load(std::memory_order_relaxed) + validationSegments;
+        result.stats.cellsTraversed = ctx.cellsTraversed.load(std::memory_order_relaxed) + validationCells;
+        result.stats.guideNs = guideNs;
+        result.stats.swarmInitNs = optimizeNs - outcome.evolutionNs;
+        result.stats.generationsNs = outcome.evolutionNs;
+        result.stats.validationNs = validationNs;
+        result.stats.totalNs = totalNs;
+        return result;
+    }
+
+public:
+    /**
+     * @brief 构造函数
+     */
+    HybridAStarPSOAlgorithm() 
+        : particleCount(50), generations(100),
+          deviationWeight(5.0), maxSpeed(1.0), globalGuideCoe(2.0), 
+          localGuideCoe(2.0), threadCount(1), batchFitness(true), stallGenerations(0),
+          improvementThreshold(0.0), minSwarmDiameter(0.0), targetFitness(NAN),
+          guidedInit(true), initJitter(1.0), randomInitFraction(0.2), corridorMargin(0.0),
+          distanceFieldResolution(0.25), collisionCacheSize(1 << 16), lazyEvaluation(true),
+          staticDimension(true), useFloat(false), asyncMode(false),
+          parameterControl(0), inertiaStart(0.9), inertiaEnd(0.4), traceCapacity(0),
+          replanGenerations(0), adaptiveWaypoints(false), minWaypoints(2), maxWaypoints(10),
+          waypointsPerTurn(2.0), turnAngleThreshold(20.0) {}
+    
+    /**
+     * @brief 析构函数
+     */
+    virtual ~HybridAStarPSOAlgorithm() = default;
+    
+    /**
+     * @brief 执行混合路径规划
+     * @param request 路径规划请求
+     * @return PathPlanningResult 规划结果
+     */
+    virtual PathPlanningResult planPath(const PathPlanningRequest& request) override {
+        std::unique_ptr<PlanContext> ctx = acquireContext();
+        PathPlanningResult result = planWithContext(*ctx, request);
+        releaseContext(std::move(ctx));
+        return result;
+    }
+    
+    /**
+     * @brief 热启动重新规划
+     * 
+     * 复用上一次的引导路径（只在新起点附近做局部A*修复），并以上一次最优路径的剩余部分
+     * 初始化粒子群；终点或航点数变化、引导路径失效时相应部分退回冷启动。
+     * @param request 新的规划请求
+     * @param previous 上一次的规划结果
+     * @return PathPlanningResult 规划结果
+     */
+    virtual PathPlanningResult replanPath(const PathPlanningRequest& request,
+                                          const PathPlanningResult& previous) override {
+        std::unique_ptr<PlanContext> ctx = acquireContext();
+        PathPlanningResult result = planWithContext(*ctx, request, &previous);
+        releaseContext(std::move(ctx));
+        return result;
+    }
+    
+    /**
+     * @brief 支持以上一次结果热启动的动态重新规划
+     */
+    virtual bool supportsDynamicReplanning() const override {
+        return true;
     }
     
     /**
@@ -311,6 +1196,58 @@ public:
             globalGuideCoe = value;
         } else if (paramName == "localGuideCoe") {
             localGuideCoe = value;
+        } else if (paramName == "threadCount") {
+            threadCount = static_cast<int>(value);
+        } else if (paramName == "batchFitness") {
+            batchFitness = value != 0.0;
+        } else if (paramName == "stallGenerations") {
+            stallGenerations = static_cast<int>(value);
+        } else if (paramName == "improvementThreshold") {
+            improvementThreshold = value;
+        } else if (paramName == "minSwarmDiameter") {
+            minSwarmDiameter = value;
+        } else if (paramName == "targetFitness") {
+            targetFitness = value;
+        } else if (paramName == "guidedInit") {
+            guidedInit = value != 0.0;
+        } else if (paramName == "initJitter") {
+            initJitter = value;
+        } else if (paramName == "randomInitFraction") {
+            randomInitFraction = value;
+        } else if (paramName == "corridorMargin") {
+            corridorMargin = value;
+        } else if (paramName == "distanceFieldResolution") {
+            distanceFieldResolution = value;
+        } else if (paramName == "collisionCacheSize") {
+            collisionCacheSize = static_cast<int>(value);
+        } else if (paramName == "lazyEvaluation") {
+            lazyEvaluation = value != 0.0;
+        } else if (paramName == "staticDimension") {
+            staticDimension = value != 0.0;
+        } else if (paramName == "useFloat") {
+            useFloat = value != 0.0;
+        } else if (paramName == "asyncMode") {
+            asyncMode = value != 0.0;
+        } else if (paramName == "parameterControl") {
+            parameterControl = std::min(std::max(static_cast<int>(value), 0), 3);
+        } else if (paramName == "inertiaStart") {
+            inertiaStart = value;
+        } else if (paramName == "inertiaEnd") {
+            inertiaEnd = value;
+        } else if (paramName == "traceCapacity") {
+            traceCapacity = std::max(0, static_cast<int>(value));
+        } else if (paramName == "replanGenerations") {
+            replanGenerations = std::max(0, static_cast<int>(value));
+        } else if (paramName == "adaptiveWaypoints") {
+            adaptiveWaypoints = value != 0.0;
+        } else if (paramName == "minWaypoints") {
+            minWaypoints = std::max(1, static_cast<int>(value));
+        } else if (paramName == "maxWaypoints") {
+            maxWaypoints = std::max(1, static_cast<int>(value));
+        } else if (paramName == "waypointsPerTurn") {
+            waypointsPerTurn = std::max(0.0, value);
+        } else if (paramName == "turnAngleThreshold") {
+            turnAngleThreshold = value;
         }
     }
     
@@ -330,6 +1267,58 @@ public:
             return globalGuideCoe;
         } else if (paramName == "localGuideCoe") {
             return localGuideCoe;
+        } else if (paramName == "threadCount") {
+            return threadCount;
+        } else if (paramName == "batchFitness") {
+            return batchFitness ? 1.0 : 0.0;
+        } else if (paramName == "stallGenerations") {
+            return stallGenerations;
+        } else if (paramName == "improvementThreshold") {
+            return improvementThreshold;
+        } else if (paramName == "minSwarmDiameter") {
+            return minSwarmDiameter;
+        } else if (paramName == "targetFitness") {
+            return targetFitness;
+        } else if (paramName == "guidedInit") {
+            return guidedInit ? 1.0 : 0.0;
+        } else if (paramName == "initJitter") {
+            return initJitter;
+        } else if (paramName == "randomInitFraction") {
+            return randomInitFraction;
+        } else if (paramName == "corridorMargin") {
+            return corridorMargin;
+        } else if (paramName == "distanceFieldResolution") {
+            return distanceFieldResolution;
+        } else if (paramName == "collisionCacheSize") {
+            return collisionCacheSize;
+        } else if (paramName == "lazyEvaluation") {
+            return lazyEvaluation ? 1.0 : 0.0;
+        } else if (paramName == "staticDimension") {
+            return staticDimension ? 1.0 : 0.0;
+        } else if (paramName == "useFloat") {
+            return useFloat ? 1.0 : 0.0;
+        } else if (paramName == "asyncMode") {
+            return asyncMode ? 1.0 : 0.0;
+        } else if (paramName == "parameterControl") {
+            return parameterControl;
+        } else if (paramName == "inertiaStart") {
+            return inertiaStart;
+        } else if (paramName == "inertiaEnd") {
+            return inertiaEnd;
+        } else if (paramName == "traceCapacity") {
+            return traceCapacity;
+        } else if (paramName == "replanGenerations") {
+            return replanGenerations;
+        } else if (paramName == "adaptiveWaypoints") {
+            return adaptiveWaypoints ? 1.0 : 0.0;
+        } else if (paramName == "minWaypoints") {
+            return minWaypoints;
+        } else if (paramName == "maxWaypoints") {
+            return maxWaypoints;
+        } else if (paramName == "waypointsPerTurn") {
+            return waypointsPerTurn;
+        } else if (paramName == "turnAngleThreshold") {
+            return turnAngleThreshold;
         }
         return 0.0;
     }
@@ -338,16 +1327,34 @@ public:
      * @brief 重置算法状态
      */
     virtual void reset() override {
-        astarGuidePath.clear();
-        psoSolver.reset();
-        currentMap = nullptr;
+        std::lock_guard<std::mutex> lock(contextMutex);
+        idleContexts.clear();
+        lastGuidePath.clear();
+        lastTrace.reset(0);
     }
     
     /**
-     * @brief 获取A*引导路径（用于可视化）
+     * @brief 获取最近一次规划的A*引导路径（用于可视化，不能与规划并发调用）
      */
     const std::vector<Point>& getAStarGuidePath() const {
-        return astarGuidePath;
+        return lastGuidePath;
+    }
+    
+    /**
+     * @brief 设置每代进化结束后的观察回调（用于收敛过程分析）
+     * @param observer 参数依次为已完成代数、全局最优适应度、全局最优路径（含起终点）；
+     *                 在规划线程上调用（并发规划时须自行保证线程安全），岛屿模型与异步模式下不调用
+     */
+    void setGenerationObserver(std::function<void(int, double, const std::vector<Point>&)> observer) {
+        generationObserver = std::move(observer);
+    }
+    
+    /**
+     * @brief 获取最近一次规划的逐代收敛记录（traceCapacity>0时有效；岛屿模型与异步模式下为空；
+     *        不能与规划并发调用）
+     */
+    const ConvergenceTrace& getConvergenceTrace() const {
+        return lastTrace;
     }
     
     /**
@@ -0,0 +1,300 @@
+#ifndef ISLAND_PSO_ALGORITHM_H
+#define ISLAND_PSO_ALGORITHM_H
+
+#include "HybridAStarPSOAlgorithm.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief 岛屿间迁移的无锁交换缓冲区（单写者、多读者的顺序锁）
+ *
+ * 每个岛屿只向自己的缓冲区发布精英粒子，其他岛屿随时读取最近一次发布的内容。
+ * 写者在写入前后各递增一次序号（奇数表示正在写入），读者读到前后序号一致
+ * 且为非零偶数时即得到一份完整快照，任何一方都不会阻塞。
+ */
+class IslandMigrationBuffer {
+private:
+    std::atomic<uint64_t> sequence;
+    std::unique_ptr<std::atomic<double>[]> records;  // eliteCount 条 [适应度, 位置...]
+    int recordLength;
+    int eliteCount;
+
+public:
+    IslandMigrationBuffer(int elites, int dimension)
+        : sequence(0), records(new std::atomic<double>[static_cast<size_t>(elites) * (dimension + 1)]),
+          recordLength(dimension + 1), eliteCount(elites) {
+        for (int i = 0; i < elites * recordLength; i++) {
+            records[i].store(0.0, std::memory_order_relaxed);
+        }
+    }
+
+    int getEliteCount() const {
+        return eliteCount;
+    }
+
+    /**
+     * @brief 发布精英粒子（仅由所属岛屿的线程调用）
+     * @param data eliteCount 条 [适应度, 位置...] 记录
+     */
+    void publish(const double* data) {
+        uint64_t seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for (int i = 0; i < eliteCount * recordLength; i++) {
+            records[i].store(data[i], std::memory_order_relaxed);
+        }
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief 读取最近一次发布的精英粒子
+     * @param out 输出缓冲区，长度至少为 eliteCount*(dimension+1)
+     * @return bool 读到完整快照返回 true；尚未发布或正在写入时返回 false
+     */
+    bool tryRead(double* out) const {
+        uint64_t before = sequence.load(std::memory_order_acquire);
+        if (before == 0 || (before & 1) != 0) {
+            return false;
+        }
+        for (int i = 0; i < eliteCount * recordLength; i++) {
+            out[i] = records[i].load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return sequence.load(std::memory_order_relaxed) == before;
+    }
+};
+
+/**
+ * @brief 岛屿模型多种群A*-PSO路径规划算法
+ *
+ * 在混合A*-PSO的基础上，将总粒子数平均分给 K 个相互独立的粒子群（岛屿），
+ * 每个岛屿在各自的线程上进化，每隔固定代数通过无锁交换缓冲区按环形或随机拓扑
+ * 迁移精英粒子。多种群保持了更高的多样性，减少单一大种群的早熟收敛。
+ *
+ * 迁移时机取决于线程调度，因此多线程下结果不保证逐位可复现。
+ */
+class IslandPSOAlgorithm : public HybridAStarPSOAlgorithm {
+private:
+    int islandCount;          // 岛屿数量 K
+    int migrationInterval;    // 迁移间隔（代）
+    int migrationSize;        // 每次迁移的精英粒子数
+    int migrationTopology;    // 0：环形拓扑，1：随机拓扑
+    std::unique_ptr<ThreadPool> islandPool;  // 每个岛屿一个线程，跨多次规划复用
+    std::mutex islandPoolMutex;
+
+    /**
+     * @brief 单个岛屿的运行状态
+     */
+    struct Island {
+        std::unique_ptr<ZPSO_Algorithm> swarm;
+        std::unique_ptr<IslandMigrationBuffer> outbox;
+        std::vector<double> exportBuffer;
+        std::vector<double> importBuffer;
+        std::vector<int> orderBuffer;
+        ZPSO_Random topologyRandom;
+    };
+
+    /**
+     * @brief 在当前线程上运行一个岛屿的全部进化过程
+     */
+    void runIsland(std::vector<Island>& islands, int index, int generationLimit, std::atomic<bool>& targetReached) {
+        Island& island = islands[index];
+        ZPSO_Algorithm& swarm = *island.swarm;
+        const int dimension = swarm._dimension;
+
+        swarm.randomlyInitial();
+        swarm._generationsUsed = 0;
+        swarm._stopReason = ZPSO_StopReason::MaxGenerations;
+        int stallCount = 0;
+        auto evolutionStart = std::chrono::steady_clock::now();
+
+        for (int generation = 0; generation < generationLimit; generation++) {
+            if (swarm.cancelRequested()) {
+                swarm._stopReason = ZPSO_StopReason::Cancelled;
+                break;
+            }
+            if (swarm.deadlineReached()) {
+                swarm._stopReason = ZPSO_StopReason::Deadline;
+                break;
+            }
+            // 任一岛屿达到目标适应度时全部岛屿停止
+            if (targetReached.load(std::memory_order_relaxed)) {
+                swarm._stopReason = ZPSO_StopReason::TargetReached;
+                break;
+            }
+            double previousBest = swarm._globalBestPartical._bestFitness;
+            swarm.beginGeneration(generation, generationLimit);
+            swarm.update();
+            swarm._generationsUsed++;
+
+            // 迁移：发布本岛精英，接收来源岛屿的精英
+            if (islands.size() > 1 && migrationInterval > 0 && (generation + 1) % migrationInterval == 0) {
+                swarm.exportElites(island.outbox->getEliteCount(), island.exportBuffer.data(),
+                                   island.orderBuffer.data());
+                island.outbox->publish(island.exportBuffer.data());
+
+                int islandTotal = static_cast<int>(islands.size());
+                int source = (index + islandTotal - 1) % islandTotal;
+                if (migrationTopology == 1) {
+                    int offset = 1 + static_cast<int>(island.topologyRandom.rand0_1() * (islandTotal - 1));
+                    source = (index + std::min(offset, islandTotal - 1)) % islandTotal;
+                }
+                if (islands[source].outbox->tryRead(island.importBuffer.data())) {
+                    for (int k = 0; k < islands[source].outbox->getEliteCount(); k++) {
+                        const double* record = island.importBuffer.data() + static_cast<size_t>(k) * (dimension + 1);
+                        swarm.importParticle(record + 1, record[0]);
+                    }
+                }
+            }
+
+            if (swarm._generationObserver) {
+                swarm._generationObserver(swarm._generationsUsed, swarm._globalBestPartical);
+            }
+            if (swarm.convergedAfterUpdate(previousBest, stallCount)) {
+                if (swarm._stopReason == ZPSO_StopReason::TargetReached) {
+                    targetReached.store(true, std::memory_order_relaxed);
+                }
+                break;
+            }
+        }
+        swarm._evolutionNs = ZPSO_Algorithm::elapsedNs(evolutionStart);
+    }
+
+protected:
+    /**
+     * @brief 以岛屿模型运行PSO优化阶段
+     */
+    virtual SwarmOutcome optimize(PlanContext& ctx,
+                                  const std::vector<double>& minBounds,
+                                  const std::vector<double>& maxBounds,
+                                  const ZPSO_StopCriteria& stopCriteria,
+                                  uint64_t seed, ZPSO_Partical& bestParticle) override {
+        const int dimension = static_cast<int>(minBounds.size());
+        const int islandTotal = std::max(1, std::min(islandCount, particleCount));
+        const int elites = std::max(1, migrationSize);
+
+        ThreadPool* pool;
+        {
+            std::lock_guard<std::mutex> lock(islandPoolMutex);
+            if (!islandPool || islandPool->getThreadCount() != islandTotal) {
+                islandPool = std::make_unique<ThreadPool>(islandTotal);
+            }
+            pool = islandPool.get();
+        }
+
+        // 平均分配粒子，每个岛屿使用由同一种子 jump 派生的独立随机序列
+        std::vector<Island> islands(islandTotal);
+        ZPSO_Random streamRandom(seed);
+        for (int i = 0; i < islandTotal; i++) {
+            int swarmSize = particleCount / islandTotal + (i < particleCount % islandTotal ? 1 : 0);
+            Island& island = islands[i];
+            island.swarm = createSwarm(ctx, minBounds, maxBounds, swarmSize, seed);
+            island.swarm->setRandom(streamRandom);
+            island.swarm->setStopCriteria(stopCriteria);
+            streamRandom.jump();
+            island.topologyRandom = streamRandom;
+            streamRandom.jump();
+
+            int islandElites = std::min(elites, swarmSize);
+            island.outbox = std::make_unique<IslandMigrationBuffer>(islandElites, dimension);
+            island.exportBuffer.resize(static_cast<size_t>(islandElites) * (dimension + 1));
+            island.importBuffer.resize(static_cast<size_t>(elites) * (dimension + 1));
+            island.orderBuffer.resize(swarmSize);
+        }
+        // 进度由0号岛屿报告（其本岛最优），回调可能在线程池线程上执行
+        if (ctx.progress) {
+            islands[0].swarm->setGenerationObserver([this, &ctx](int generation, const ZPSO_Partical& islandBest) {
+                reportProgress(ctx, PlanningStage::Optimize, generation, islandBest._bestFitness);
+            });
+        }
+
+        // 线程池被另一次并发规划占用时各岛屿在本线程上依次进化（迁移只读取已发布的精英，不会等待）
+        std::atomic<bool> targetReached(false);
+        pool->parallelFor(islandTotal, [&](int index) {
+            runIsland(islands, index, ctx.generations, targetReached);
+        });
+
+        // 取各岛屿中的全局最优
+        int bestIsland = 0;
+        int generationsUsed = 0;
+        int64_t evolutionNs = 0;  // 岛屿并行进化，取最慢岛屿的进化耗时
+        for (int i = 0; i < islandTotal; i++) {
+            if (islands[i].swarm->_globalBestPartical._bestFitness >
+                islands[bestIsland].swarm->_globalBestPartical._bestFitness) {
+                bestIsland = i;
+            }
+            generationsUsed = std::max(generationsUsed, islands[i].swarm->_generationsUsed);
+            evolutionNs = std::max(evolutionNs, islands[i].swarm->_evolutionNs);
+        }
+        bestParticle.copy(islands[bestIsland].swarm->_globalBestPartical);
+        return {generationsUsed, islands[bestIsland].swarm->_stopReason, evolutionNs};
+    }
+
+public:
+    /**
+     * @brief 构造函数
+     */
+    IslandPSOAlgorithm()
+        : islandCount(4), migrationInterval(10), migrationSize(2), migrationTopology(0) {}
+
+    virtual ~IslandPSOAlgorithm() = default;
+
+    /**
+     * @brief 获取算法名称
+     */
+    virtual std::string getAlgorithmName() const override {
+        return "Island A*-PSO";
+    }
+
+    /**
+     * @brief 设置算法参数（岛屿参数之外的交给混合算法处理）
+     */
+    virtual void setParameter(const std::string& paramName, double value) override {
+        if (paramName == "islandCount") {
+            islandCount = std::max(1, static_cast<int>(value));
+        } else if (paramName == "migrationInterval") {
+            migrationInterval = static_cast<int>(value);
+        } else if (paramName == "migrationSize") {
+            migrationSize = static_cast<int>(value);
+        } else if (paramName == "migrationTopology") {
+            migrationTopology = static_cast<int>(value);
+        } else {
+            HybridAStarPSOAlgorithm::setParameter(paramName, value);
+        }
+    }
+
+    /**
+     * @brief 获取算法参数
+     */
+    virtual double getParameter(const std::string& paramName) const override {
+        if (paramName == "islandCount") {
+            return islandCount;
+        } else if (paramName == "migrationInterval") {
+            return migrationInterval;
+        } else if (paramName == "migrationSize") {
+            return migrationSize;
+        } else if (paramName == "migrationTopology") {
+            return migrationTopology;
+        }
+        return HybridAStarPSOAlgorithm::getParameter(paramName);
+    }
+
+    /**
+     * @brief 获取算法复杂度信息
+     */
+    virtual std::string getComplexityInfo() const override {
+        return "A*: O(b^d), PSO: O(P*G*D/K) 每线程, K=岛屿数";
+    }
+
+    /**
+     * @brief 获取使用场景描述
+     */
+    virtual std::string getUsageDescription() const override {
+        return "岛屿模型多种群算法：适用于多核环境下易早熟收敛的复杂地图路径规划";
+    }
+};
+
+#endif // ISLAND_PSO_ALGORITHM_H
@@ -0,0 +1,183 @@
+#ifndef RESERVATION_TABLE_H
+#define RESERVATION_TABLE_H
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief 多机器人时空预约表：记录 (网格, 时间步) 被哪个机器人占用
+ *
+ * 以 (时间步 << 32 | 网格编号) 为键的开放寻址哈希表（线性探测、容量为2的幂），
+ * 每个槽位只有 12 字节，负载超过一半时扩容；clear() 保留槽位数组以便下一次规划复用。
+ * 机器人到达终点后停留不动，用按网格的停靠记录表示（不为之后的每个时间步逐一插入）。
+ * 非线程安全，每个规划器独占一个实例。
+ */
+class ReservationTable {
+public:
+    static constexpr int NONE = -1;
+
+private:
+    static constexpr uint64_t EMPTY_KEY = std::numeric_limits<uint64_t>::max();
+
+    struct Slot {
+        uint64_t key;
+        int32_t agent;
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    size_t capacityMask;                 // 容量 - 1
+    size_t count;                        // 已占用槽位数
+    std::vector<int> parkedAgent;        // 各网格上停靠的机器人（NONE为无）
+    std::vector<int> parkedSince;        // 停靠开始的时间步
+    std::vector<int> lastReservedStep;   // 各网格被预约的最晚时间步（-1为从未预约）
+
+    static uint64_t makeKey(int cell, int step) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(step)) << 32) | static_cast<uint32_t>(cell);
+    }
+
+    static size_t hashKey(uint64_t key) {
+        key ^= key >> 33;
+        key *= 0xFF51AFD7ED558CCDULL;
+        key ^= key >> 33;
+        return static_cast<size_t>(key);
+    }
+
+    void allocate(size_t capacity) {
+        slots.reset(new Slot[capacity]);
+        capacityMask = capacity - 1;
+        for (size_t i = 0; i < capacity; i++) {
+            slots[i].key = EMPTY_KEY;
+        }
+    }
+
+    void grow() {
+        std::unique_ptr<Slot[]> old = std::move(slots);
+        size_t oldCapacity = capacityMask + 1;
+        allocate(oldCapacity * 2);
+        for (size_t i = 0; i < oldCapacity; i++) {
+            if (old[i].key != EMPTY_KEY) {
+                size_t index = hashKey(old[i].key) & capacityMask;
+                while (slots[index].key != EMPTY_KEY) {
+                    index = (index + 1) & capacityMask;
+                }
+                slots[index] = old[i];
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief 构造函数
+     * @param capacity 初始槽位数，向上取整为2的幂
+     */
+    explicit ReservationTable(size_t capacity = 1 << 12) : capacityMask(0), count(0) {
+        size_t size = 16;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        allocate(size);
+    }
+
+    /**
+     * @brief 清空全部预约并设置地图网格数（槽位数组保留）
+     */
+    void reset(int cellCount) {
+        if (count > 0) {
+            for (size_t i = 0; i <= capacityMask; i++) {
+                slots[i].key = EMPTY_KEY;
+            }
+        }
+        count = 0;
+        parkedAgent.assign(cellCount, NONE);
+        parkedSince.assign(cellCount, 0);
+        lastReservedStep.assign(cellCount, -1);
+    }
+
+    /**
+     * @brief 预约网格在某一时间步的占用
+     * @return bool 该时刻已被其他机器人占用时返回 false（不覆盖）
+     */
+    bool reserve(int cell, int step, int agent) {
+        if ((count + 1) * 2 > capacityMask + 1) {
+            grow();
+        }
+        uint64_t key = makeKey(cell, step);
+        size_t index = hashKey(key) & capacityMask;
+        while (slots[index].key != EMPTY_KEY) {
+            if (slots[index].key == key) {
+                return slots[index].agent == agent;
+            }
+            index = (index + 1) & capacityMask;
+        }
+        slots[index].key = key;
+        slots[index].agent = agent;
+        count++;
+        if (step > lastReservedStep[cell]) {
+            lastReservedStep[cell] = step;
+        }
+        return true;
+    }
+
+    /**
+     * @brief 机器人自某一时间步起永久停靠在网格上（到达终点）
+     */
+    void park(int cell, int fromStep, int agent) {
+        parkedAgent[cell] = agent;
+        parkedSince[cell] = fromStep;
+    }
+
+    /**
+     * @brief 查询网格在某一时间步的占用者（含停靠的机器人）
+     * @return int 机器人编号，无人占用时为 NONE
+     */
+    int owner(int cell, int step) const {
+        if (parkedAgent[cell] != NONE && step >= parkedSince[cell]) {
+            return parkedAgent[cell];
+        }
+        if (lastReservedStep[cell] < step) {
+            return NONE;
+        }
+        uint64_t key = makeKey(cell, step);
+        size_t index = hashKey(key) & capacityMask;
+        while (slots[index].key != EMPTY_KEY) {
+            if (slots[index].key == key) {
+                return slots[index].agent;
+            }
+            index = (index + 1) & capacityMask;
+        }
+        return NONE;
+    }
+
+    /**
+     * @brief 网格被预约（不含停靠）的最晚时间步，从未预约时为 -1
+     */
+    int lastReserved(int cell) const {
+        return lastReservedStep[cell];
+    }
+
+    /**
+     * @brief 网格上停靠的机器人（NONE为无）及停靠开始的时间步
+     */
+    int parkedAt(int cell, int& sinceStep) const {
+        sinceStep = parkedSince[cell];
+        return parkedAgent[cell];
+    }
+
+    /**
+     * @brief 已预约的 (网格, 时间步) 数
+     */
+    size_t size() const {
+        return count;
+    }
+
+    /**
+     * @brief 当前槽位数
+     */
+    size_t capacity() const {
+        return capacityMask + 1;
+    }
+};
+
+#endif // RESERVATION_TABLE_H
@@ -0,0 +1,136 @@
+#ifndef SEGMENT_COLLISION_CACHE_H
+#define SEGMENT_COLLISION_CACHE_H
+
+#include "../../include/Common.h"
+#include "../core/Map.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief 线段碰撞检测结果缓存（开放寻址、容量固定、无锁）
+ *
+ * Map::isLineColliding 只依赖两个端点所在的网格，因此以端点网格坐标为键缓存结果
+ * 与直接计算完全等价。每个槽位是一个 64 位原子整数：
+ *   [0,60) 四个 15 位网格坐标 (x0, y0, x1, y1)，[60] 碰撞结果，[61] 占用标记。
+ * 线性探测，写入用 CAS 抢占空槽；探测长度超过上限或坐标超出 15 位时直接计算、不缓存。
+ * 槽位数组在构造时一次性分配，查询与写入过程不分配堆内存，可被多个线程同时调用。
+ */
+class SegmentCollisionCache {
+private:
+    static constexpr int COORD_BITS = 15;
+    static constexpr uint64_t COORD_MASK = (1ULL << COORD_BITS) - 1;
+    static constexpr uint64_t KEY_MASK = (1ULL << (4 * COORD_BITS)) - 1;
+    static constexpr uint64_t VERDICT_BIT = 1ULL << 60;
+    static constexpr uint64_t OCCUPIED_BIT = 1ULL << 61;
+    static constexpr int MAX_PROBES = 16;
+
+    std::unique_ptr<std::atomic<uint64_t>[]> slots;
+    size_t capacityMask;      // 容量 - 1（容量为2的幂）
+    double cellSize;
+
+    /**
+     * @brief 计算线段的缓存键（与 Map::isLineColliding 相同的量化方式）
+     * @return bool 端点网格坐标可以用 15 位表示时返回 true
+     */
+    bool makeKey(const Point& start, const Point& end, uint64_t& key) const {
+        int cells[4] = {
+            static_cast<int>(start.x / cellSize), static_cast<int>(start.y / cellSize),
+            static_cast<int>(end.x / cellSize), static_cast<int>(end.y / cellSize)
+        };
+        key = 0;
+        for (int i = 0; i < 4; i++) {
+            if (cells[i] < 0 || static_cast<uint64_t>(cells[i]) > COORD_MASK) {
+                return false;
+            }
+            key |= static_cast<uint64_t>(cells[i]) << (i * COORD_BITS);
+        }
+        return true;
+    }
+
+    static size_t hashKey(uint64_t key) {
+        key ^= key >> 33;
+        key *= 0xFF51AFD7ED558CCDULL;
+        key ^= key >> 33;
+        return static_cast<size_t>(key);
+    }
+
+public:
+    /**
+     * @brief 构造函数
+     * @param capacity 槽位数，向上取整为2的幂
+     */
+    explicit SegmentCollisionCache(size_t capacity = 1 << 16) : capacityMask(0), cellSize(1.0) {
+        size_t size = 1;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        slots.reset(new std::atomic<uint64_t>[size]);
+        capacityMask = size - 1;
+        reset(1.0);
+    }
+
+    /**
+     * @brief 获取槽位数
+     */
+    size_t capacity() const {
+        return capacityMask + 1;
+    }
+
+    /**
+     * @brief 清空缓存（每次规划开始时调用，不可与查询并发）
+     * @param mapCellSize 当前地图的网格大小
+     */
+    void reset(double mapCellSize) {
+        cellSize = mapCellSize;
+        for (size_t i = 0; i <= capacityMask; i++) {
+            slots[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief 带缓存的线段碰撞检测
+     * @param map 地图
+     * @param start 线段起点
+     * @param end 线段终点
+     * @param hit 输出：结果是否来自缓存
+     * @return bool 与 map.isLineColliding(start, end) 相同
+     */
+    bool isLineColliding(const Map& map, const Point& start, const Point& end, bool& hit) {
+        uint64_t cellsTraversed = 0;
+        return isLineColliding(map, start, end, hit, cellsTraversed);
+    }
+
+    /**
+     * @brief 带缓存的线段碰撞检测，并将未命中时实际检查的网格数累加到 cellsTraversed
+     */
+    bool isLineColliding(const Map& map, const Point& start, const Point& end, bool& hit,
+                         uint64_t& cellsTraversed) {
+        uint64_t key;
+        if (!makeKey(start, end, key)) {
+            hit = false;
+            return map.isLineColliding(start, end, cellsTraversed);
+        }
+
+        size_t index = hashKey(key) & capacityMask;
+        for (int probe = 0; probe < MAX_PROBES; probe++, index = (index + 1) & capacityMask) {
+            uint64_t slot = slots[index].load(std::memory_order_relaxed);
+            if (slot == 0) {
+                bool colliding = map.isLineColliding(start, end, cellsTraversed);
+                uint64_t entry = OCCUPIED_BIT | (colliding ? VERDICT_BIT : 0) | key;
+                // 抢占失败说明另一个线程刚写入了该槽位，结果仍然正确，只是不再缓存
+                slots[index].compare_exchange_strong(slot, entry, std::memory_order_relaxed);
+                hit = false;
+                return colliding;
+            }
+            if ((slot & KEY_MASK) == key) {
+                hit = true;
+                return (slot & VERDICT_BIT) != 0;
+            }
+        }
+        hit = false;
+        return map.isLineColliding(start, end, cellsTraversed);
+    }
+};
+
+#endif // SEGMENT_COLLISION_CACHE_H
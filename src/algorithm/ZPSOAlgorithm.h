@@ -3,227 +3,925 @@
 #include <stdlib.h>
 #include <time.h>
 #include <math.h>
+#include <stdint.h>
 #include <vector>
 #include <memory>
 #include <random>
 #include <functional>
+#include <chrono>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <utility>
+#include "../core/ThreadPool.h"
+#include "ConvergenceTrace.h"
 
-// 粒子群算法例子个体
-class ZPSO_Partical
+// 粒子群算法伪随机数发生器（xoshiro256+）
+// 每个算法实例（或线程）独立持有一份状态，不存在 rand() 的全局锁，
+// 且可由显式种子完全复现。满足 UniformRandomBitGenerator 要求，
+// 也可直接配合 <random> 中的分布使用。
+class ZPSO_Random
 {
 public:
-    std::vector<double> _position; // 使用 vector 替代裸指针
-    std::vector<double> _velocity;
-    std::vector<double> _bestPosition;
+    using result_type = uint64_t;
+
+    explicit ZPSO_Random(uint64_t seedValue = 1) { seed(seedValue); }
+
+    /***************************************************************
+     * 函数名：seed
+     * 函数描述：用 splitmix64 将64位种子扩展为256位内部状态
+     * 输入参数：
+     *  seedValue：随机种子
+     * 输出参数：void
+     ***************************************************************/
+    void seed(uint64_t seedValue)
+    {
+        uint64_t x = seedValue;
+        for (int i = 0; i < 4; i++)
+        {
+            x += 0x9E3779B97F4A7C15ULL;
+            uint64_t z = x;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            _state[i] = z ^ (z >> 31);
+        }
+    }
+
+    /***************************************************************
+     * 函数名：next
+     * 函数描述：生成下一个64位随机数
+     * 输入参数：void
+     * 输出参数：
+     *  uint64_t：64位随机数
+     ***************************************************************/
+    uint64_t next()
+    {
+        const uint64_t result = _state[0] + _state[3];
+        const uint64_t t = _state[1] << 17;
+        _state[2] ^= _state[0];
+        _state[3] ^= _state[1];
+        _state[1] ^= _state[2];
+        _state[0] ^= _state[3];
+        _state[2] ^= t;
+        _state[3] = rotl(_state[3], 45);
+        return result;
+    }
+
+    /***************************************************************
+     * 函数名：jump
+     * 函数描述：将状态前进2^128步，用于为不同线程派生互不重叠的随机序列
+     * 输入参数：void
+     * 输出参数：void
+     ***************************************************************/
+    void jump()
+    {
+        static const uint64_t JUMP[] = {0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+                                        0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL};
+        uint64_t s[4] = {0, 0, 0, 0};
+        for (uint64_t jumpWord : JUMP)
+        {
+            for (int b = 0; b < 64; b++)
+            {
+                if (jumpWord & (1ULL << b))
+                {
+                    for (int i = 0; i < 4; i++)
+                        s[i] ^= _state[i];
+                }
+                next();
+            }
+        }
+        for (int i = 0; i < 4; i++)
+            _state[i] = s[i];
+    }
+
+    // 在[0,1)上均匀分布的随机数（取高53位）
+    double rand0_1() { return (next() >> 11) * (1.0 / 9007199254740992.0); }
+
+    /***************************************************************
+     * 函数名：fill0_1
+     * 函数描述：批量生成[0,1)均匀分布随机数
+     * 输入参数：
+     *  out：输出数组，由调用者提供空间
+     *  count：生成个数
+     * 输出参数：void
+     ***************************************************************/
+    void fill0_1(double *out, int count)
+    {
+        for (int i = 0; i < count; i++)
+            out[i] = rand0_1();
+    }
+
+    /***************************************************************
+     * 函数名：gaussian
+     * 函数描述：生成一个标准正态分布随机数（Box-Muller变换，不缓存第二个值）
+     * 输入参数：void
+     * 输出参数：
+     *  double：均值0、标准差1的随机数
+     ***************************************************************/
+    double gaussian()
+    {
+        double u1 = 1.0 - rand0_1(); // (0,1]，避免log(0)
+        double u2 = rand0_1();
+        return sqrt(-2.0 * log(u1)) * cos(6.283185307179586 * u2);
+    }
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return UINT64_MAX; }
+    result_type operator()() { return next(); }
+
+private:
+    uint64_t _state[4];
+
+    static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+};
+
+// 粒子群提前终止条件（各项取0/false表示不启用该条件）
+struct ZPSO_StopCriteria
+{
+    int stallGenerations = 0;                        // 全局最优连续无改进的代数上限
+    double minRelativeImprovement = 0.0;             // 视为"有改进"的最小相对提升，以max(|f|,1)归一化
+    double minSwarmDiameter = 0.0;                   // 粒子群包围盒对角线长度下限
+    bool useTargetFitness = false;                   // 是否在达到目标适应度时停止
+    double targetFitness = 0.0;                      // 目标适应度
+    bool useDeadline = false;                        // 是否启用墙钟截止时间
+    std::chrono::steady_clock::time_point deadline;  // 墙钟截止时间
+    const std::atomic<bool> *cancelFlag = nullptr;   // 外部取消标志，置位后在下一代开始前停止
+
+    // 以 start 起算 seconds 秒的时间预算设置截止时间。预算 <=0 或非有限值时不启用；
+    // 超过时钟可表示范围一半（约146年）的预算同样不启用，避免换算为纳秒计数时溢出
+    void setTimeBudget(std::chrono::steady_clock::time_point start, double seconds)
+    {
+        double representable = std::chrono::duration<double>(std::chrono::steady_clock::time_point::max() - start).count();
+        useDeadline = seconds > 0.0 && seconds < representable / 2;
+        if (useDeadline)
+        {
+            deadline = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                   std::chrono::duration<double>(seconds));
+        }
+    }
+};
+
+// 粒子群速度更新参数的控制方式
+enum class ZPSO_ParameterControl
+{
+    Fixed,          // 固定参数（无惯性权重，原有更新规则）
+    LinearInertia,  // 惯性权重随代数由inertiaStart线性递减到inertiaEnd
+    Constriction,   // Clerc收缩因子：v ← χ(v + 引导项)，φ=c1+c2不大于4时按比例放大到4.1
+    SuccessRate     // 按上一代个体最优改进比例调整最大速度（1/5成功率规则）
+};
+
+// 粒子群参数控制设置
+struct ZPSO_ParameterSchedule
+{
+    ZPSO_ParameterControl mode = ZPSO_ParameterControl::Fixed;
+    double inertiaStart = 0.9;        // 线性递减惯性权重的初值
+    double inertiaEnd = 0.4;          // 线性递减惯性权重的终值
+    double successTarget = 0.2;       // 成功率高于该值时增大最大速度，否则减小
+    double speedIncrease = 1.25;      // 最大速度增大倍数（不超过初始最大速度）
+    double speedDecrease = 0.8;       // 最大速度减小倍数
+    double minSpeedFraction = 0.05;   // 最大速度下限（相对初始最大速度）
+};
+
+// 粒子群终止原因
+enum class ZPSO_StopReason
+{
+    MaxGenerations, // 运行完全部进化代数
+    Stalled,        // 全局最优停滞
+    SwarmCollapsed, // 粒子群收缩
+    Deadline,       // 到达截止时间
+    TargetReached,  // 达到目标适应度
+    Cancelled       // 外部取消
+};
+
+// 粒子坐标存储：D>0时为定长std::array（维度在编译期确定），D==0时为std::vector
+template <int D, typename Real>
+struct ZPSO_Storage
+{
+    using type = std::array<Real, D>;
+    static void resize(type &, int) {}
+};
+
+template <typename Real>
+struct ZPSO_Storage<0, Real>
+{
+    using type = std::vector<Real>;
+    static void resize(type &values, int dimension) { values.resize(dimension); }
+};
+
+// 对每一维 j=0..dimension-1 调用 f(j)：D>0时用折叠表达式在编译期完全展开，
+// D==0时退化为运行时循环。调用顺序与普通循环相同，浮点结果逐位一致。
+template <int D>
+struct ZPSO_Unroll
+{
+    template <typename Func, size_t... I>
+    static void apply(Func &f, std::index_sequence<I...>) { (f(static_cast<int>(I)), ...); }
+
+    template <typename Func>
+    static void run(int, Func &&f) { apply(f, std::make_index_sequence<D>()); }
+};
+
+template <>
+struct ZPSO_Unroll<0>
+{
+    template <typename Func>
+    static void run(int dimension, Func &&f)
+    {
+        for (int j = 0; j < dimension; j++)
+            f(j);
+    }
+};
+
+// 粒子群算法例子个体（D为编译期维度，0表示运行时维度；Real为坐标精度）
+template <int D, typename Real>
+class ZPSO_ParticalT
+{
+public:
+    using Storage = typename ZPSO_Storage<D, Real>::type;
+
+    Storage _position; // 定长维度用 std::array，运行时维度用 vector
+    Storage _velocity;
+    Storage _bestPosition;
     double _fitness = 0.0;
     double _bestFitness = 0.0;
 
     // 默认构造函数
-    ZPSO_Partical() = default;
+    ZPSO_ParticalT() = default;
 
-    // 带维度的构造函数
-    explicit ZPSO_Partical(int dimension)
-        : _position(dimension), _velocity(dimension), _bestPosition(dimension) {}
+    // 带维度的构造函数（定长维度时忽略参数）
+    explicit ZPSO_ParticalT(int dimension)
+    {
+        initial(dimension);
+    }
 
     // 使用默认的拷贝构造函数和赋值操作符
-    ZPSO_Partical(const ZPSO_Partical &) = default;
-    ZPSO_Partical &operator=(const ZPSO_Partical &) = default;
+    ZPSO_ParticalT(const ZPSO_ParticalT &) = default;
+    ZPSO_ParticalT &operator=(const ZPSO_ParticalT &) = default;
 
     // 使用默认的移动构造函数和移动赋值操作符
-    ZPSO_Partical(ZPSO_Partical &&) = default;
-    ZPSO_Partical &operator=(ZPSO_Partical &&) = default;
+    ZPSO_ParticalT(ZPSO_ParticalT &&) = default;
+    ZPSO_ParticalT &operator=(ZPSO_ParticalT &&) = default;
 
     // 析构函数自动调用，vector 自动清理内存
-    ~ZPSO_Partical() = default;
+    ~ZPSO_ParticalT() = default;
 
     // 初始化函数
     void initial(int dimension)
     {
         if (getDimension() != dimension)
         {
-            _position.resize(dimension);
-            _velocity.resize(dimension);
-            _bestPosition.resize(dimension);
+            ZPSO_Storage<D, Real>::resize(_position, dimension);
+            ZPSO_Storage<D, Real>::resize(_velocity, dimension);
+            ZPSO_Storage<D, Real>::resize(_bestPosition, dimension);
         }
     }
 
     // 获取维度
     int getDimension() const { return static_cast<int>(_position.size()); }
 
-    // 复制函数
-    void copy(const ZPSO_Partical &other)
+    // 复制函数（维度相同时原地复制，不重新分配内存）
+    void copy(const ZPSO_ParticalT &other)
+    {
+        if (getDimension() == other.getDimension())
+        {
+            std::copy(other._position.begin(), other._position.end(), _position.begin());
+            std::copy(other._velocity.begin(), other._velocity.end(), _velocity.begin());
+            std::copy(other._bestPosition.begin(), other._bestPosition.end(), _bestPosition.begin());
+        }
+        else
+        {
+            _position = other._position;
+            _velocity = other._velocity;
+            _bestPosition = other._bestPosition;
+        }
+        _fitness = other._fitness;
+        _bestFitness = other._bestFitness;
+    }
+
+    // 从其他维度类型或精度的粒子复制（逐元素转换）
+    template <int OtherD, typename OtherReal>
+    void copyFrom(const ZPSO_ParticalT<OtherD, OtherReal> &other)
     {
-        _position = other._position;
-        _velocity = other._velocity;
-        _bestPosition = other._bestPosition;
+        initial(other.getDimension());
+        std::copy(other._position.begin(), other._position.end(), _position.begin());
+        std::copy(other._velocity.begin(), other._velocity.end(), _velocity.begin());
+        std::copy(other._bestPosition.begin(), other._bestPosition.end(), _bestPosition.begin());
         _fitness = other._fitness;
         _bestFitness = other._bestFitness;
     }
 };
 
+// 运行时维度、双精度的粒子
+using ZPSO_Partical = ZPSO_ParticalT<0, double>;
+
+// 异步（稳态）模式下多个工作线程共享的全局最优
+// 顺序锁：写者以CAS把序号由偶数改为奇数获得写权限，写完再改回偶数；
+// 读者从不阻塞，读到前后序号一致的偶数即为完整快照，否则沿用自己上次读到的副本。
+template <typename Real>
+class ZPSO_AsyncBest
+{
+public:
+    explicit ZPSO_AsyncBest(int dimension)
+        : _sequence(0), _fitness(-INFINITY), _position(new std::atomic<Real>[dimension]), _dimension(dimension)
+    {
+        for (int j = 0; j < dimension; j++)
+            _position[j].store(0, std::memory_order_relaxed);
+    }
+
+    double fitness() const { return _fitness.load(std::memory_order_relaxed); }
+
+    /***************************************************************
+     * 函数名：tryImprove
+     * 函数描述：适应度严格优于当前全局最优时写入新的全局最优
+     * 输入参数：
+     *  fitness：候选适应度
+     *  position：候选位置，长度为dimension
+     * 输出参数：
+     *  bool：写入成功返回true
+     ***************************************************************/
+    bool tryImprove(double fitness, const Real *position)
+    {
+        for (;;)
+        {
+            if (!(fitness > _fitness.load(std::memory_order_relaxed)))
+                return false;
+            uint64_t seq = _sequence.load(std::memory_order_relaxed);
+            if ((seq & 1) != 0 || !_sequence.compare_exchange_weak(seq, seq + 1, std::memory_order_acquire,
+                                                                   std::memory_order_relaxed))
+                continue;
+            // 取得写权限后再次比较，期间其他写者可能已写入更优的解
+            bool improved = fitness > _fitness.load(std::memory_order_relaxed);
+            if (improved)
+            {
+                std::atomic_thread_fence(std::memory_order_release);
+                for (int j = 0; j < _dimension; j++)
+                    _position[j].store(position[j], std::memory_order_relaxed);
+                _fitness.store(fitness, std::memory_order_relaxed);
+            }
+            _sequence.store(seq + 2, std::memory_order_release);
+            return improved;
+        }
+    }
+
+    /***************************************************************
+     * 函数名：tryRead
+     * 函数描述：读取全局最优快照
+     * 输入参数：
+     *  position：输出位置，长度为dimension
+     *  fitness：输出适应度
+     * 输出参数：
+     *  bool：读到完整快照返回true，正在写入时返回false
+     * 注意：返回false时position可能已被写入新旧混合的半写内容，
+     *       调用者需要保留上一份有效副本时应读入临时缓冲区，成功后再复制
+     ***************************************************************/
+    template <typename Storage>
+    bool tryRead(Storage &position, double &fitness) const
+    {
+        uint64_t before = _sequence.load(std::memory_order_acquire);
+        if ((before & 1) != 0)
+            return false;
+        for (int j = 0; j < _dimension; j++)
+            position[j] = _position[j].load(std::memory_order_relaxed);
+        fitness = _fitness.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return _sequence.load(std::memory_order_relaxed) == before;
+    }
+
+private:
+    std::atomic<uint64_t> _sequence;
+    std::atomic<double> _fitness;
+    std::unique_ptr<std::atomic<Real>[]> _position;
+    int _dimension;
+};
+
 // PSO算法
-class ZPSO_Algorithm
+// D为编译期维度（0表示运行时维度），Real为粒子位置与速度的精度，适应度始终为double。
+// 编译期维度下粒子使用std::array存储，逐维度内核由ZPSO_Unroll完全展开。
+template <int D, typename Real>
+class ZPSO_AlgorithmT
 {
 public:
+    using Partical = ZPSO_ParticalT<D, Real>;
+    using Storage = typename ZPSO_Storage<D, Real>::type;
+
     int _dimension;                        // 粒子群维度
     int _particalCount;                    // 种群粒子数量
     double _globalGuideCoe;                // 全局最优引导系数
     double _localGuideCoe;                 // 局部最优引导系数
-    ZPSO_Partical _globalBestPartical;     // 搜索过程得到的全局最优粒子
-    std::vector<double> _positionMinValue; // 使用 vector 替代裸指针
-    std::vector<double> _positionMaxValue;
+    Partical _globalBestPartical;          // 搜索过程得到的全局最优粒子
+    Storage _positionMinValue;             // 各维度下界
+    Storage _positionMaxValue;             // 各维度上界
     double _maxSpeed;                                        // 粒子允许最大速度
-    std::function<double(ZPSO_Partical &)> _fitnessFunction; // 使用 std::function
-    std::vector<ZPSO_Partical> _particalSet;                 // 使用 vector 管理粒子数组
+    double _baseMaxSpeed;                                    // 初始最大速度（成功率控制以此为上限）
+    ZPSO_ParameterSchedule _parameterSchedule;               // 速度更新参数控制方式
+    double _velocityScale = 1.0;                             // 本代速度项系数（惯性权重或收缩因子）
+    double _guideScale = 1.0;                                // 本代引导项系数
+    double _successRate = 0.0;                               // 上一次归约中个体最优得到改进的粒子比例
+    std::function<void(int, const Partical &)> _generationObserver; // 每代结束后的观察回调（可选）
+    ConvergenceTrace *_trace = nullptr;                      // 逐代收敛记录（可选，为空时不记录）
+    std::function<double(Partical &)> _fitnessFunction;      // 使用 std::function
+    // 批量适应度函数（可选）：输入粒子位置矩阵（count×dimension，行优先）与各粒子个体最优适应度，
+    // 输出count个适应度
+    std::function<void(const Real *, const double *, int, int, double *)> _batchFitnessFunction;
+    std::vector<Partical> _particalSet;                      // 使用 vector 管理粒子数组
+    ZPSO_Random _random;                                     // 实例独立的随机数发生器
+    std::vector<double> _randomBuffer;                       // 批量随机数缓冲区
+    typename ZPSO_Storage<D, double>::type _disturbanceBuffer; // 扰动速度缓冲区
+    ThreadPool *_threadPool = nullptr;                       // 并行评估线程池（可选）
+    std::vector<Real> _positionMatrix;                       // 批量评估用的位置矩阵
+    std::vector<double> _bestFitnessArray;                   // 批量评估输入的个体最优适应度
+    std::vector<double> _fitnessArray;                       // 批量评估输出
+    ZPSO_StopCriteria _stopCriteria;                         // 提前终止条件
+    std::vector<double> _initialCenter;                      // 引导初始化中心（为空则均匀随机初始化）
+    bool _includeCenter = false;                             // 最后一个粒子是否恰好位于引导中心
+    double _initialJitter = 0.0;                             // 引导初始化高斯扰动标准差
+    double _randomInitFraction = 0.0;                        // 引导初始化时仍均匀随机初始化的粒子比例
+    int _generationsUsed = 0;                                // 上一次搜索实际进化代数
+    int64_t _evolutionNs = 0;                                // 上一次搜索初始化之后进化阶段的耗时（纳秒）
+    ZPSO_StopReason _stopReason = ZPSO_StopReason::MaxGenerations; // 上一次搜索的终止原因
     /***************************************************************
-     * 函数名：ZPSO_Algorithm
+     * 函数名：ZPSO_AlgorithmT
      * 函数描述：构造一个PSO算法
      * 输入参数：
      *  objFunction：优化目标函数指针
      *  positionMinValue：解下界，其任一维度注意应低于上界
      *  positionMaxValue：解上界，其任一维度注意应高于下界
-     *  dimension：解空间维度
+     *  dimension：解空间维度，编译期维度D>0时必须等于D
      *  particalCount：种群粒子个数
      *  globalGuideCoe：粒子种群全局最优引导速度因子，默认为2
      *  localGuideCoe：粒子种群个体最优引导速度因子，默认为2
      *  maxSpeed：粒子运动最大速度
+     *  seed：随机种子，相同种子得到完全相同的搜索过程
      * 输出参数：
-     *  ZPSO_Algorithm&：构建得到的PSO算法本身
+     *  ZPSO_AlgorithmT&：构建得到的PSO算法本身
      ***************************************************************/
-    ZPSO_Algorithm(std::function<double(ZPSO_Partical &)> objFunction,
-                   const double *positionMinValue, const double *positionMaxValue,
-                   int dimension, int particalCount,
-                   double globalGuideCoe = 2.0, double localGuideCoe = 2.0,
-                   double maxSpeed = 1.0)
+    ZPSO_AlgorithmT(std::function<double(Partical &)> objFunction,
+                    const double *positionMinValue, const double *positionMaxValue,
+                    int dimension, int particalCount,
+                    double globalGuideCoe = 2.0, double localGuideCoe = 2.0,
+                    double maxSpeed = 1.0, uint64_t seed = 1)
         : _dimension(dimension),
           _particalCount(particalCount),
           _globalGuideCoe(globalGuideCoe),
           _localGuideCoe(localGuideCoe), 
           _globalBestPartical(dimension), 
-          _positionMinValue(positionMinValue, 
-          positionMinValue + dimension), 
-          _positionMaxValue(positionMaxValue, 
-          positionMaxValue + dimension), 
           _maxSpeed(maxSpeed), 
+          _baseMaxSpeed(maxSpeed),
           _fitnessFunction(std::move(objFunction)), 
           _particalSet(particalCount, 
-          ZPSO_Partical(dimension))
+          Partical(dimension)),
+          _random(seed),
+          _randomBuffer(2 * dimension),
+          _positionMatrix(static_cast<size_t>(particalCount) * dimension),
+          _bestFitnessArray(particalCount),
+          _fitnessArray(particalCount)
     {
-        // vector 自动管理内存，无需手动分配
+        // 所有缓冲区在构造时一次性分配，进化过程中不再分配堆内存
+        ZPSO_Storage<D, Real>::resize(_positionMinValue, dimension);
+        ZPSO_Storage<D, Real>::resize(_positionMaxValue, dimension);
+        ZPSO_Storage<D, double>::resize(_disturbanceBuffer, dimension);
+        std::copy(positionMinValue, positionMinValue + dimension, _positionMinValue.begin());
+        std::copy(positionMaxValue, positionMaxValue + dimension, _positionMaxValue.begin());
     }
     /***************************************************************
-     * 函数名：~ZPSO_Algorithm
+     * 函数名：~ZPSO_AlgorithmT
      * 函数描述：析构一个PSO算法，释放算法内存
      * 输入参数：void
      * 输出参数：void
-     * 在 C++ 中，~ZPSO_Algorithm(void) 是一个析构函数（destructor）?，它的作用是在对象被销毁时自动调用，用于清理资源?（如释放动态内存、关闭文件、释放锁等）。
+     * 在 C++ 中，~ZPSO_AlgorithmT(void) 是一个析构函数（destructor）?，它的作用是在对象被销毁时自动调用，用于清理资源?（如释放动态内存、关闭文件、释放锁等）。
+     ***************************************************************/
+    ~ZPSO_AlgorithmT() = default;
+    /***************************************************************
+     * 函数名：setSeed
+     * 函数描述：重新设定随机种子
+     * 输入参数：
+     *  seed：随机种子
+     * 输出参数：void
+     ***************************************************************/
+    void setSeed(uint64_t seed) { _random.seed(seed); }
+    /***************************************************************
+     * 函数名：setRandom
+     * 函数描述：替换随机数发生器（如为不同线程注入jump后的独立序列）
+     * 输入参数：
+     *  random：新的随机数发生器
+     * 输出参数：void
      ***************************************************************/
-    ~ZPSO_Algorithm() = default;
+    void setRandom(const ZPSO_Random &random) { _random = random; }
     /***************************************************************
      * 函数名：rand0_1
      * 函数描述：生成一个0-1的均匀分布随机数
      * 输入参数：void
      * 输出参数：
-     *  double：在0-1上均匀分布的随机数
+     *  double：在[0,1)上均匀分布的随机数
      ***************************************************************/
-    double rand0_1() { return ((1.0 * rand()) / RAND_MAX); }
+    double rand0_1() { return _random.rand0_1(); }
     /***************************************************************
-     * 函数名：refresh
-     * 函数描述：计算粒子适应度并更新粒子个体最优位置与全局最优位置
+     * 函数名：setThreadPool
+     * 函数描述：设置并行评估所用的线程池，为nullptr时串行评估
+     *          线程池不归算法所有，其生命周期由调用者保证；
+     *          并行与串行模式在相同种子下得到完全相同的结果
+     * 输入参数：
+     *  threadPool：常驻线程池
+     * 输出参数：void
+     ***************************************************************/
+    void setThreadPool(ThreadPool *threadPool) { _threadPool = threadPool; }
+    /***************************************************************
+     * 函数名：setBatchFitnessFunction
+     * 函数描述：设置批量适应度函数，设置后优先于逐粒子的_fitnessFunction使用；
+     *          并行模式下矩阵按行切块分别调用，因此每行结果须只依赖于该行；
+     *          惰性评估的约定同_fitnessFunction（见evaluateAll）
+     * 输入参数：
+     *  batchFunction：批量适应度函数，参数依次为位置矩阵、个体最优适应度、粒子数、维度、适应度输出
+     * 输出参数：void
+     ***************************************************************/
+    void setBatchFitnessFunction(std::function<void(const Real *, const double *, int, int, double *)> batchFunction)
+    {
+        _batchFitnessFunction = std::move(batchFunction);
+    }
+    /***************************************************************
+     * 函数名：setStopCriteria
+     * 函数描述：设置findMax的提前终止条件
+     * 输入参数：
+     *  criteria：终止条件
+     * 输出参数：void
+     ***************************************************************/
+    void setStopCriteria(const ZPSO_StopCriteria &criteria) { _stopCriteria = criteria; }
+    /***************************************************************
+     * 函数名：setParameterSchedule
+     * 函数描述：设置速度更新参数的控制方式，当前最大速度作为初始最大速度
+     * 输入参数：
+     *  schedule：参数控制设置
+     * 输出参数：void
+     ***************************************************************/
+    void setParameterSchedule(const ZPSO_ParameterSchedule &schedule)
+    {
+        _parameterSchedule = schedule;
+        _baseMaxSpeed = _maxSpeed;
+    }
+    /***************************************************************
+     * 函数名：setGenerationObserver
+     * 函数描述：设置每代进化结束后的观察回调（同步搜索时在调用线程上执行）
+     * 输入参数：
+     *  observer：参数依次为已完成的代数（从1计）与当前全局最优粒子
+     * 输出参数：void
+     ***************************************************************/
+    void setGenerationObserver(std::function<void(int, const Partical &)> observer)
+    {
+        _generationObserver = std::move(observer);
+    }
+    /***************************************************************
+     * 函数名：setTrace
+     * 函数描述：挂接逐代收敛记录，同步搜索时每代记录一次（含初始种群）
+     * 输入参数：
+     *  trace：收敛记录，由调用者持有；传入nullptr取消记录
+     * 输出参数：void
+     ***************************************************************/
+    void setTrace(ConvergenceTrace *trace)
+    {
+        _trace = trace;
+    }
+    /***************************************************************
+     * 函数名：setInitialGuide
+     * 函数描述：设置引导初始化，粒子围绕给定中心按高斯分布初始化
+     * 输入参数：
+     *  center：初始化中心，长度为_dimension；传入nullptr取消引导初始化
+     *  jitter：各维度高斯扰动的标准差
+     *  randomFraction：仍在整个搜索空间均匀随机初始化的粒子比例，用于保持多样性
+     *  includeCenter：为true时最后一个粒子不加扰动地放在中心上（热启动时保留上一次的最优解）
+     * 输出参数：void
+     ***************************************************************/
+    void setInitialGuide(const double *center, double jitter, double randomFraction, bool includeCenter = false)
+    {
+        if (center == nullptr)
+        {
+            _initialCenter.clear();
+            return;
+        }
+        _initialCenter.assign(center, center + _dimension);
+        _initialJitter = jitter;
+        _randomInitFraction = std::min(std::max(randomFraction, 0.0), 1.0);
+        _includeCenter = includeCenter;
+    }
+    /***************************************************************
+     * 函数名：swarmDiameter
+     * 函数描述：计算当前粒子位置包围盒的对角线长度
+     * 输入参数：void
+     * 输出参数：
+     *  double：粒子群直径
+     ***************************************************************/
+    double swarmDiameter() const
+    {
+        double diameterSq = 0;
+        for (int j = 0; j < _dimension; j++)
+        {
+            double minVal = _particalSet[0]._position[j];
+            double maxVal = minVal;
+            for (int i = 1; i < _particalCount; i++)
+            {
+                minVal = std::min(minVal, static_cast<double>(_particalSet[i]._position[j]));
+                maxVal = std::max(maxVal, static_cast<double>(_particalSet[i]._position[j]));
+            }
+            diameterSq += (maxVal - minVal) * (maxVal - minVal);
+        }
+        return sqrt(diameterSq);
+    }
+    /***************************************************************
+     * 函数名：deadlineReached
+     * 函数描述：检查是否已到达墙钟截止时间
+     * 输入参数：void
+     * 输出参数：
+     *  bool：到达截止时间返回true
+     ***************************************************************/
+    bool deadlineReached() const
+    {
+        return _stopCriteria.useDeadline && std::chrono::steady_clock::now() >= _stopCriteria.deadline;
+    }
+    /***************************************************************
+     * 函数名：cancelRequested
+     * 函数描述：检查外部取消标志是否已置位
+     * 输入参数：void
+     * 输出参数：
+     *  bool：已请求取消返回true
+     ***************************************************************/
+    bool cancelRequested() const
+    {
+        return _stopCriteria.cancelFlag != nullptr && _stopCriteria.cancelFlag->load(std::memory_order_relaxed);
+    }
+    /***************************************************************
+     * 函数名：elapsedNs
+     * 函数描述：计算自给定时刻起经过的纳秒数
+     * 输入参数：
+     *  start：起始时刻
+     * 输出参数：
+     *  int64_t：经过的纳秒数
+     ***************************************************************/
+    static int64_t elapsedNs(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+    /***************************************************************
+     * 函数名：convergedAfterUpdate
+     * 函数描述：一代进化后检查目标、停滞与收缩条件，命中时记录终止原因
+     * 输入参数：
+     *  previousBest：本代进化前的全局最优适应度
+     *  stallCount：连续无改进代数计数，由调用者持有
+     * 输出参数：
+     *  bool：满足终止条件返回true
+     ***************************************************************/
+    bool convergedAfterUpdate(double previousBest, int &stallCount)
+    {
+        if (_stopCriteria.useTargetFitness && _globalBestPartical._bestFitness >= _stopCriteria.targetFitness)
+        {
+            _stopReason = ZPSO_StopReason::TargetReached;
+            return true;
+        }
+        if (_stopCriteria.stallGenerations > 0)
+        {
+            double improvement = _globalBestPartical._bestFitness - previousBest;
+            double threshold = _stopCriteria.minRelativeImprovement * std::max(fabs(previousBest), 1.0);
+            if (improvement > threshold)
+                stallCount = 0;
+            else if (++stallCount >= _stopCriteria.stallGenerations)
+            {
+                _stopReason = ZPSO_StopReason::Stalled;
+                return true;
+            }
+        }
+        if (_stopCriteria.minSwarmDiameter > 0 && swarmDiameter() < _stopCriteria.minSwarmDiameter)
+        {
+            _stopReason = ZPSO_StopReason::SwarmCollapsed;
+            return true;
+        }
+        return false;
+    }
+    /***************************************************************
+     * 函数名：exportElites
+     * 函数描述：导出个体最优适应度最高的若干粒子（用于岛屿模型迁移）
+     * 输入参数：
+     *  count：导出粒子数，不超过种群粒子数
+     *  out：输出数组，每个粒子依次写入[最优适应度, 最优位置(dimension个)]，
+     *       长度至少为count*(dimension+1)，由调用者提供
+     *  order：长度至少为种群粒子数的下标缓冲区，由调用者提供以避免分配
+     * 输出参数：void
+     ***************************************************************/
+    void exportElites(int count, double *out, int *order) const
+    {
+        count = std::min(count, _particalCount);
+        for (int i = 0; i < _particalCount; i++)
+            order[i] = i;
+        std::partial_sort(order, order + count, order + _particalCount, [this](int a, int b)
+                          { return _particalSet[a]._bestFitness > _particalSet[b]._bestFitness; });
+        for (int k = 0; k < count; k++)
+        {
+            const Partical &elite = _particalSet[order[k]];
+            double *record = out + static_cast<size_t>(k) * (_dimension + 1);
+            record[0] = elite._bestFitness;
+            std::copy(elite._bestPosition.begin(), elite._bestPosition.end(), record + 1);
+        }
+    }
+    /***************************************************************
+     * 函数名：importParticle
+     * 函数描述：以外来粒子替换个体最优最差的粒子（若外来粒子更优）
+     * 输入参数：
+     *  position：外来粒子位置，长度为dimension
+     *  fitness：外来粒子适应度
+     * 输出参数：
+     *  bool：发生替换返回true
+     ***************************************************************/
+    bool importParticle(const double *position, double fitness)
+    {
+        int worst = 0;
+        for (int i = 1; i < _particalCount; i++)
+        {
+            if (_particalSet[i]._bestFitness < _particalSet[worst]._bestFitness)
+                worst = i;
+        }
+        Partical &target = _particalSet[worst];
+        if (!(fitness > target._bestFitness))
+            return false;
+        std::copy(position, position + _dimension, target._position.begin());
+        std::copy(position, position + _dimension, target._bestPosition.begin());
+        target._fitness = fitness;
+        target._bestFitness = fitness;
+        if (fitness > _globalBestPartical._bestFitness)
+            _globalBestPartical.copy(target);
+        return true;
+    }
+    /***************************************************************
+     * 函数名：evaluateAll
+     * 函数描述：计算所有粒子的适应度（可并行），只写各粒子自身的_fitness。
+     *          适应度函数可以惰性评估：若能证明粒子的真实适应度不超过其_bestFitness，
+     *          可返回任意不超过_bestFitness的值（如上界）而不完整计算，
+     *          因为reduceBest只在严格大于时更新个体最优
      * 输入参数：void
      * 输出参数：void
      ***************************************************************/
-    void refresh()
+    void evaluateAll()
+    {
+        if (_batchFitnessFunction)
+        {
+            evaluateAllBatched();
+            return;
+        }
+        if (_threadPool != nullptr)
+        {
+            _threadPool->parallelFor(_particalCount, [this](int i)
+                                     { _particalSet[i]._fitness = _fitnessFunction(_particalSet[i]); });
+        }
+        else
+        {
+            for (int i = 0; i < _particalCount; i++)
+                _particalSet[i]._fitness = _fitnessFunction(_particalSet[i]);
+        }
+    }
+    /***************************************************************
+     * 函数名：evaluateAllBatched
+     * 函数描述：将粒子位置汇集为矩阵后调用批量适应度函数；
+     *          有线程池时按行切块并行调用
+     * 输入参数：void
+     * 输出参数：void
+     ***************************************************************/
+    void evaluateAllBatched()
+    {
+        for (int i = 0; i < _particalCount; i++)
+        {
+            std::copy(_particalSet[i]._position.begin(), _particalSet[i]._position.end(),
+                      _positionMatrix.begin() + static_cast<size_t>(i) * _dimension);
+            _bestFitnessArray[i] = _particalSet[i]._bestFitness;
+        }
+
+        int chunkCount = 1;
+        if (_threadPool != nullptr)
+            chunkCount = std::min(_particalCount, _threadPool->getThreadCount() * 4);
+        if (chunkCount <= 1)
+        {
+            _batchFitnessFunction(_positionMatrix.data(), _bestFitnessArray.data(), _particalCount, _dimension,
+                                  _fitnessArray.data());
+        }
+        else
+        {
+            int chunkSize = (_particalCount + chunkCount - 1) / chunkCount;
+            _threadPool->parallelFor(chunkCount, [this, chunkSize](int chunk)
+                                     {
+                int begin = chunk * chunkSize;
+                int count = std::min(chunkSize, _particalCount - begin);
+                if (count > 0)
+                    _batchFitnessFunction(_positionMatrix.data() + static_cast<size_t>(begin) * _dimension,
+                                          _bestFitnessArray.data() + begin, count, _dimension, _fitnessArray.data() + begin); });
+        }
+
+        for (int i = 0; i < _particalCount; i++)
+            _particalSet[i]._fitness = _fitnessArray[i];
+    }
+    /***************************************************************
+     * 函数名：reduceBest
+     * 函数描述：按粒子下标顺序更新个体最优与全局最优（确定性归约）
+     * 输入参数：void
+     * 输出参数：void
+     ***************************************************************/
+    void reduceBest()
     {
         int globalBestParticalIndex = -1;
+        int successCount = 0;
+        double globalBestFitness = _globalBestPartical._bestFitness;
         for (int i = 0; i < _particalCount; i++)
         {
-            // 循环遍历所有粒子，更新粒子适应度
-            _particalSet[i]._fitness = _fitnessFunction(_particalSet[i]);
             if (_particalSet[i]._fitness > _particalSet[i]._bestFitness)
             {
+                successCount++;
                 // 更新粒子的个体最优位置
-                _particalSet[i]._bestPosition = _particalSet[i]._position;
+                std::copy(_particalSet[i]._position.begin(), _particalSet[i]._position.end(),
+                          _particalSet[i]._bestPosition.begin());
                 _particalSet[i]._bestFitness = _particalSet[i]._fitness;
                 // 是否更新全局最优解
-                if (_particalSet[i]._bestFitness > _globalBestPartical._bestFitness)
+                if (_particalSet[i]._bestFitness > globalBestFitness)
+                {
                     globalBestParticalIndex = i;
+                    globalBestFitness = _particalSet[i]._bestFitness;
+                }
             }
         }
         // 更新全局最优粒子位置
         if (globalBestParticalIndex != -1)
             _globalBestPartical.copy(_particalSet[globalBestParticalIndex]);
+        _successRate = static_cast<double>(successCount) / _particalCount;
+    }
+    /***************************************************************
+     * 函数名：refresh
+     * 函数描述：计算粒子适应度并更新粒子个体最优位置与全局最优位置
+     * 输入参数：void
+     * 输出参数：void
+     ***************************************************************/
+    void refresh()
+    {
+        this->evaluateAll();
+        this->reduceBest();
     }
     /***************************************************************
      * 函数名：randomlyInitial
-     * 函数描述：随机初始化种群中粒子位置
+     * 函数描述：随机初始化种群中粒子位置（设置了引导中心时部分粒子围绕中心初始化）
      * 输入参数：void
      * 输出参数：void
      ***************************************************************/
     void randomlyInitial(void)
     {
-        int globalBestParticalIndex = -1;
-        // 遍历所有粒子
-
-        // 初始化第0个粒子与全局最优粒子
-        // 初始化粒子位置与速度
-        double velocityMod = 0;
-        // 遍历粒子的任一维度
-        for (int j = 0; j < _particalSet[0].getDimension(); j++)
-        {
-            // 随机初始化粒子位置与最佳位置
-            double tempVal = _positionMinValue[j];
-            tempVal += rand0_1() * (_positionMaxValue[j] - _positionMinValue[j]);
-            _particalSet[0]._position[j] = tempVal;
-            _particalSet[0]._bestPosition[j] = tempVal;
-            // 随机初始化粒子速度
-            _particalSet[0]._velocity[j] = rand0_1();
-            velocityMod += _particalSet[0]._velocity[j] * _particalSet[0]._velocity[j];
-        }
-        // 粒子速度归化为随机大小v_mod
-        double v_mod = rand0_1() * _maxSpeed;
-        velocityMod = sqrt(velocityMod);
-        for (size_t j = 0; j < _particalSet[0]._position.size(); j++)
-            _particalSet[0]._velocity[j] *= (v_mod / velocityMod);
-
-        // 更新粒子初代适应度值与最佳适应度值
-        _particalSet[0]._fitness = _fitnessFunction(_particalSet[0]);
-        _particalSet[0]._bestFitness = _particalSet[0]._fitness;
-        _globalBestPartical.copy(_particalSet[0]);
+        // 每次搜索从初始最大速度开始（成功率控制会在搜索中调整_maxSpeed）
+        if (_parameterSchedule.mode == ZPSO_ParameterControl::SuccessRate)
+            _maxSpeed = _baseMaxSpeed;
+        _successRate = 0.0;
+        // 设置了引导中心时，前 randomCount 个粒子均匀随机初始化，其余围绕中心高斯分布
+        int randomCount = _particalCount;
+        if (!_initialCenter.empty())
+            randomCount = static_cast<int>(_randomInitFraction * _particalCount + 0.5);
 
-        // 初始化1~_particalCount-1个粒子
-        for (int i = 1; i < _particalCount; i++)
+        // 遍历所有粒子，初始化粒子位置与速度（随机数按粒子顺序串行生成）
+        for (int i = 0; i < _particalCount; i++)
         {
-            velocityMod = 0;
-            // 初始化粒子位置与速度
+            double velocityMod = 0;
             // 遍历粒子的任一维度
-            for (size_t j = 0; j < _particalSet[i]._position.size(); j++)
+            for (int j = 0; j < _dimension; j++)
             {
-                // 随机初始化粒子位置与最佳位置
-                double tempVal = _positionMinValue[j];
-                tempVal += rand0_1() * (_positionMaxValue[j] - _positionMinValue[j]);
+                // 初始化粒子位置与最佳位置
+                double tempVal;
+                if (i < randomCount)
+                {
+                    tempVal = _positionMinValue[j];
+                    tempVal += rand0_1() * (_positionMaxValue[j] - _positionMinValue[j]);
+                }
+                else
+                {
+                    tempVal = _initialCenter[j];
+                    if (!_includeCenter || i != _particalCount - 1)
+                        tempVal += _initialJitter * _random.gaussian();
+                    tempVal = std::min(std::max(tempVal, static_cast<double>(_positionMinValue[j])),
+                                       static_cast<double>(_positionMaxValue[j]));
+                }
                 _particalSet[i]._position[j] = tempVal;
                 _particalSet[i]._bestPosition[j] = tempVal;
                 // 随机初始化粒子速度
                 _particalSet[i]._velocity[j] = rand0_1();
                 velocityMod += _particalSet[i]._velocity[j] * _particalSet[i]._velocity[j];
             }
+            // 尚无个体最优，保证初代适应度被完整计算（惰性评估不会跳过）
+            _particalSet[i]._bestFitness = -INFINITY;
             // 粒子速度归化为随机大小v_mod
-            v_mod = rand0_1() * _maxSpeed;
+            double v_mod = rand0_1() * _maxSpeed;
             velocityMod = sqrt(velocityMod);
-            for (size_t j = 0; j < _particalSet[i]._position.size(); j++)
+            for (int j = 0; j < _dimension; j++)
                 _particalSet[i]._velocity[j] *= (v_mod / velocityMod);
+        }
 
-            // 更新粒子初代适应度值与最佳适应度值
-            _particalSet[i]._fitness = _fitnessFunction(_particalSet[i]);
+        // 更新粒子初代适应度值与最佳适应度值
+        this->evaluateAll();
+        int globalBestParticalIndex = 0;
+        for (int i = 0; i < _particalCount; i++)
+        {
             _particalSet[i]._bestFitness = _particalSet[i]._fitness;
-            if (_particalSet[i]._bestFitness > _globalBestPartical._bestFitness)
+            if (_particalSet[i]._bestFitness > _particalSet[globalBestParticalIndex]._bestFitness)
                 globalBestParticalIndex = i;
         }
 
         // 更新粒子群全局最佳数据
-        if (globalBestParticalIndex != -1)
-            _globalBestPartical.copy(_particalSet[globalBestParticalIndex]);
+        _globalBestPartical.copy(_particalSet[globalBestParticalIndex]);
     }
     /***************************************************************
      * 函数名：disturbance
@@ -233,40 +931,119 @@ public:
      *  relativeVelocityRate：扰动速度大小上限相对于_maxSpeed的比例，默认为0.05
      * 输出参数：void
      ***************************************************************/
-    void disturbance(ZPSO_Partical &partical, double relativeVelocityRate = 0.05)
+    void disturbance(Partical &partical, double relativeVelocityRate = 0.05)
+    {
+        disturbance(partical, relativeVelocityRate, _random, _disturbanceBuffer);
+    }
+    /***************************************************************
+     * 函数名：disturbance
+     * 函数描述：使用给定随机数发生器与缓冲区扰动粒子速度（异步模式下每个工作线程各持一份）
+     * 输入参数：
+     *  partical：被扰动的粒子对象
+     *  relativeVelocityRate：扰动速度大小上限相对于_maxSpeed的比例
+     *  random：随机数发生器
+     *  disturbanceVelocity：长度为_dimension的扰动速度缓冲区
+     * 输出参数：void
+     ***************************************************************/
+    void disturbance(Partical &partical, double relativeVelocityRate, ZPSO_Random &random,
+                     typename ZPSO_Storage<D, double>::type &disturbanceVelocity)
     {
-        // 生成扰动速度
-        std::vector<double> disturbanceVelocity(_dimension);
         // 随机生成扰动速度大小
-        double disturbanceVelocityMod = relativeVelocityRate * _maxSpeed * rand0_1();
+        double disturbanceVelocityMod = relativeVelocityRate * _maxSpeed * random.rand0_1();
+        random.fill0_1(disturbanceVelocity.data(), _dimension);
         double v_mod = 0;
         for (int i = 0; i < _dimension; i++)
-        {
-            disturbanceVelocity[i] = rand0_1();
             v_mod += disturbanceVelocity[i] * disturbanceVelocity[i];
-        }
         v_mod = sqrt(v_mod);
         // 扰动速度大小归化到disturbanceVelocityMod
         for (int i = 0; i < _dimension; i++)
             disturbanceVelocity[i] *= (disturbanceVelocityMod / v_mod);
         // 扰动粒子速度
-        v_mod = 0;
-        for (int i = 0; i < _dimension; i++)
+        Real velocityMod = 0;
+        ZPSO_Unroll<D>::run(_dimension, [&](int i)
+                            {
+            partical._velocity[i] += static_cast<Real>(disturbanceVelocity[i]);
+            velocityMod += partical._velocity[i] * partical._velocity[i]; });
+        velocityMod = std::sqrt(velocityMod);
+        // 粒子速度受限
+        limitSpeed(partical, velocityMod);
+    }
+    /***************************************************************
+     * 函数名：controlCoefficients
+     * 函数描述：按参数控制方式计算第generation代（从0计）的速度更新系数，
+     *          速度更新为 v ← velocityScale·v + guideScale·(全局引导项 + 个体引导项)
+     * 输入参数：
+     *  generation：当前代数
+     *  times：最大进化代数
+     *  velocityScale：输出速度项系数
+     *  guideScale：输出引导项系数
+     * 输出参数：void
+     ***************************************************************/
+    void controlCoefficients(int generation, int times, double &velocityScale, double &guideScale) const
+    {
+        velocityScale = 1.0;
+        guideScale = 1.0;
+        if (_parameterSchedule.mode == ZPSO_ParameterControl::LinearInertia)
         {
-            partical._velocity[i] += disturbanceVelocity[i];
-            v_mod += partical._velocity[i] * partical._velocity[i];
+            double progress = times > 1 ? static_cast<double>(generation) / (times - 1) : 1.0;
+            velocityScale = _parameterSchedule.inertiaStart +
+                            (_parameterSchedule.inertiaEnd - _parameterSchedule.inertiaStart) * std::min(progress, 1.0);
         }
-        v_mod = sqrt(v_mod);
-        // 粒子速度受限
-        if (v_mod > _maxSpeed)
+        else if (_parameterSchedule.mode == ZPSO_ParameterControl::Constriction)
+        {
+            // χ = 2 / (φ - 2 + sqrt(φ² - 4φ))，要求 φ > 4
+            double phi = _globalGuideCoe + _localGuideCoe;
+            double stretch = phi > 4.0 ? 1.0 : 4.1 / std::max(phi, 1e-12);
+            phi *= stretch;
+            velocityScale = 2.0 / (phi - 2.0 + sqrt(phi * phi - 4.0 * phi));
+            guideScale = velocityScale * stretch;
+        }
+    }
+    /***************************************************************
+     * 函数名：beginGeneration
+     * 函数描述：在每代update之前调用，更新本代的速度更新系数；
+     *          成功率控制时依据上一代的成功率调整最大速度
+     * 输入参数：
+     *  generation：当前代数（从0计）
+     *  times：最大进化代数
+     * 输出参数：void
+     ***************************************************************/
+    void beginGeneration(int generation, int times)
+    {
+        controlCoefficients(generation, times, _velocityScale, _guideScale);
+        if (_parameterSchedule.mode == ZPSO_ParameterControl::SuccessRate)
         {
-            for (int i = 0; i < _dimension; i++)
-                partical._velocity[i] *= (_maxSpeed / v_mod);
+            if (_successRate > _parameterSchedule.successTarget)
+                _maxSpeed = std::min(_maxSpeed * _parameterSchedule.speedIncrease, _baseMaxSpeed);
+            else
+                _maxSpeed = std::max(_maxSpeed * _parameterSchedule.speedDecrease,
+                                     _baseMaxSpeed * _parameterSchedule.minSpeedFraction);
+        }
+    }
+    /***************************************************************
+     * 函数名：limitSpeed
+     * 函数描述：速度模超过_maxSpeed时按比例缩放到_maxSpeed
+     * 输入参数：
+     *  partical：粒子对象
+     *  velocityMod：当前速度模
+     * 输出参数：void
+     ***************************************************************/
+    void limitSpeed(Partical &partical, Real velocityMod)
+    {
+        const Real maxSpeed = static_cast<Real>(_maxSpeed);
+        if (velocityMod > maxSpeed)
+        {
+            const Real scale = maxSpeed / velocityMod;
+            ZPSO_Unroll<D>::run(_dimension, [&](int j)
+                                { partical._velocity[j] *= scale; });
         }
     }
     /***************************************************************
      * 函数名：update
      * 函数描述：更新粒子群粒子位置与适应度
+     *          分为三个阶段：串行移动所有粒子（保证随机数顺序确定）、
+     *          评估全部粒子适应度（可并行）、按下标顺序归约最优解，
+     *          因此并行评估与串行评估的结果逐位一致
      * 输入参数：
      *  disturbanceRate：粒子速度扰动概率，默认为0.2
      *  disturbanceVelocityCoe：速度扰动因子，表征扰动速度相对_maxSpeed大小
@@ -276,118 +1053,299 @@ public:
     void update(double disturbanceRate = 0.2,
                 double disturbanceVelocityCoe = 0.05)
     {
-        double v_mod;
-        // 遍历所有粒子
+        // 参数控制：velocityScale为惯性权重或收缩因子，固定参数时两者均为1（结果不变）。
+        // 每代有两次速度更新，velocityScale只在阶段四（评估之后、使用新最优解）的更新中乘一次，
+        // 因此每代的速度衰减恰为w（或χ），而不是w²；引导项系数两次更新都按guideScale缩放
+        const Real velocityScale = static_cast<Real>(_velocityScale);
+        const Real globalGuideCoe = static_cast<Real>(_globalGuideCoe * _guideScale);
+        const Real localGuideCoe = static_cast<Real>(_localGuideCoe * _guideScale);
+        // 阶段一：遍历所有粒子，更新速度与位置
         for (int i = 0; i < _particalCount; i++)
         {
+            Partical &partical = _particalSet[i];
+            const Real r1 = static_cast<Real>(rand0_1());
+            const Real r2 = static_cast<Real>(rand0_1());
             // 遍历所有维度
-            v_mod = 0;
-            double r1 = rand0_1();
-            double r2 = rand0_1();
-            for (size_t j = 0; j < _particalSet[i]._position.size(); j++)
-            {
-                // 速度更新
+            Real v_mod = 0;
+            ZPSO_Unroll<D>::run(_dimension, [&](int j)
+                                {
                 // 全局最优位置加速度
-                _particalSet[i]._velocity[j] += _globalGuideCoe * r1 * (_globalBestPartical._bestPosition[j] - _particalSet[i]._position[j]);
+                partical._velocity[j] += globalGuideCoe * r1 * (_globalBestPartical._bestPosition[j] - partical._position[j]);
                 // 个体局部最优位置加速度
-                _particalSet[i]._velocity[j] += _localGuideCoe * r2 * (_particalSet[i]._bestPosition[j] - _particalSet[i]._position[j]);
+                partical._velocity[j] += localGuideCoe * r2 * (partical._bestPosition[j] - partical._position[j]);
                 // 粒子速度模二
-                v_mod += _particalSet[i]._velocity[j] * _particalSet[i]._velocity[j];
-            }
+                v_mod += partical._velocity[j] * partical._velocity[j]; });
             // 粒子速度受限
-            v_mod = sqrt(v_mod);
-            if (v_mod > _maxSpeed)
-                for (size_t j = 0; j < _particalSet[i]._position.size(); j++)
-                    _particalSet[i]._velocity[j] *= (_maxSpeed / v_mod);
+            limitSpeed(partical, std::sqrt(v_mod));
             // 对粒子速度进行扰动，提高算法局部搜索能力
             if (rand0_1() < disturbanceRate)
-                this->disturbance(_particalSet[i], disturbanceVelocityCoe);
+                this->disturbance(partical, disturbanceVelocityCoe);
             // 位置更新
-            for (size_t j = 0; j < _particalSet[i]._position.size(); j++)
-            {
-                _particalSet[i]._position[j] += _particalSet[i]._velocity[j];
+            ZPSO_Unroll<D>::run(_dimension, [&](int j)
+                                {
+                partical._position[j] += partical._velocity[j];
                 // 粒子位置受限
-                if (_particalSet[i]._position[j] < _positionMinValue[j])
-                    _particalSet[i]._position[j] = _positionMinValue[j];
-                else if (_particalSet[i]._position[j] > _positionMaxValue[j])
-                    _particalSet[i]._position[j] = _positionMaxValue[j];
-            }
-            // 更新粒子适应度
-            _particalSet[i]._fitness = _fitnessFunction(_particalSet[i]);
-            // 更新粒子个体最优位置
-            if (_particalSet[i]._fitness > _particalSet[i]._bestFitness)
-            {
-                _particalSet[i]._bestPosition = _particalSet[i]._position;
-                _particalSet[i]._bestFitness = _particalSet[i]._fitness;
-                // 更新全局最优解
-                if (_particalSet[i]._bestFitness > _globalBestPartical._bestFitness)
-                {
-                    _globalBestPartical.copy(_particalSet[i]);
-                }
-            }
-            // 更新粒子速度
-            for (size_t j = 0; j < _particalSet[i]._position.size(); j++)
-            {
-                _particalSet[i]._velocity[j] += _globalGuideCoe * rand0_1() * (_globalBestPartical._bestPosition[j] - _particalSet[i]._position[j]) +
-                                                _localGuideCoe * rand0_1() * (_particalSet[i]._bestPosition[j] - _particalSet[i]._position[j]);
-            }
-            // 速度限制
-            double velocityMod = 0;
-            for (size_t j = 0; j < _particalSet[i]._position.size(); j++)
-                velocityMod += _particalSet[i]._velocity[j] * _particalSet[i]._velocity[j];
-            velocityMod = sqrt(velocityMod);
-            if (velocityMod > _maxSpeed)
-            {
-                for (size_t j = 0; j < _particalSet[i]._position.size(); j++)
-                    _particalSet[i]._velocity[j] *= (_maxSpeed / velocityMod);
-            }
+                if (partical._position[j] < _positionMinValue[j])
+                    partical._position[j] = _positionMinValue[j];
+                else if (partical._position[j] > _positionMaxValue[j])
+                    partical._position[j] = _positionMaxValue[j]; });
         }
-        // 更新粒子群适应度
+        // 阶段二、三：评估粒子适应度，更新个体最优与全局最优
+        // （原实现在此之后再调用一次refresh()，对未移动的粒子重复计算适应度，已合并）
         this->refresh();
+        // 阶段四：根据新的最优解更新粒子速度
+        for (int i = 0; i < _particalCount; i++)
+        {
+            Partical &partical = _particalSet[i];
+            // 批量生成每一维的两个随机因子
+            _random.fill0_1(_randomBuffer.data(), 2 * _dimension);
+            Real velocityMod = 0;
+            ZPSO_Unroll<D>::run(_dimension, [&](int j)
+                                {
+                partical._velocity[j] = velocityScale * partical._velocity[j] +
+                                        (globalGuideCoe * static_cast<Real>(_randomBuffer[2 * j]) * (_globalBestPartical._bestPosition[j] - partical._position[j]) +
+                                         localGuideCoe * static_cast<Real>(_randomBuffer[2 * j + 1]) * (partical._bestPosition[j] - partical._position[j])); });
+            // 速度限制
+            ZPSO_Unroll<D>::run(_dimension, [&](int j)
+                                { velocityMod += partical._velocity[j] * partical._velocity[j]; });
+            limitSpeed(partical, std::sqrt(velocityMod));
+        }
+    }
+    /***************************************************************
+     * 函数名：recordTrace
+     * 函数描述：向收敛记录追加当前代的全局最优、适应度均值与粒子群直径
+     * 输入参数：
+     *  generation：当前代数
+     * 输出参数：void
+     ***************************************************************/
+    void recordTrace(int generation)
+    {
+        double fitnessSum = 0;
+        for (int i = 0; i < _particalCount; i++)
+            fitnessSum += _particalSet[i]._fitness;
+        _trace->record(generation, _globalBestPartical._bestFitness, fitnessSum / _particalCount, swarmDiameter());
     }
     /***************************************************************
      * 函数名：findMax
      * 函数描述：采用粒子群算法搜索最优解
      * 输入参数：
-     *  times：粒子群进化次数
+     *  times：粒子群最大进化次数，满足_stopCriteria时提前结束，
+     *         实际代数与终止原因记录在_generationsUsed与_stopReason中
      *  bestPartical：进化得到的最优个体
      *  disturbanceRate：粒子速度扰动概率，默认为0.2
      *  disturbanceVelocityCoe：速度扰动因子，表征扰动速度相对_maxSpeed大小
      *                          用于扰动粒子速度以提高局部搜索能力，默认为0.05
      * 输出参数：void
      ***************************************************************/
-    void findMax(int times, ZPSO_Partical &bestPartical,
+    void findMax(int times, Partical &bestPartical,
                  double disturbanceRate = 0.2,
                  double disturbanceVelocityCoe = 0.05)
     {
+        if (_trace)
+            _trace->clear();
         this->randomlyInitial();
+        _generationsUsed = 0;
+        _stopReason = ZPSO_StopReason::MaxGenerations;
+        int stallCount = 0;
+        if (_trace)
+            recordTrace(0);
+        auto evolutionStart = std::chrono::steady_clock::now();
         for (int i = 0; i < times; i++)
+        {
+            if (cancelRequested())
+            {
+                _stopReason = ZPSO_StopReason::Cancelled;
+                break;
+            }
+            if (deadlineReached())
+            {
+                _stopReason = ZPSO_StopReason::Deadline;
+                break;
+            }
+            double previousBest = _globalBestPartical._bestFitness;
+            this->beginGeneration(i, times);
             this->update(disturbanceRate, disturbanceVelocityCoe);
+            _generationsUsed++;
+            if (_trace)
+                recordTrace(_generationsUsed);
+            if (_generationObserver)
+                _generationObserver(_generationsUsed, _globalBestPartical);
+            if (convergedAfterUpdate(previousBest, stallCount))
+                break;
+        }
+        _evolutionNs = elapsedNs(evolutionStart);
         bestPartical.copy(_globalBestPartical);
     }
     /***************************************************************
-     * 函数名：findMax
-     * 函数描述：采用粒子群算法搜索最优解
+     * 函数名：findMaxAsync
+     * 函数描述：异步（稳态）粒子群搜索。初始化后不再按代同步：
+     *          各工作线程从共享的轮转队列领取粒子，依据最近读到的全局最优更新其速度与位置，
+     *          评估后立即更新个体最优并以CAS尝试更新共享全局最优，随即领取下一个粒子，
+     *          线程之间没有每代一次的屏障，不会等待最慢的粒子。
+     *          总评估次数上限为times*粒子数；_generationsUsed记录折算的代数
+     *          （评估次数/粒子数）。支持取消、截止时间、目标适应度与停滞终止条件
+     *          （停滞按每粒子数次评估计一代），不支持粒子群收缩条件。
+     *          惯性权重与收缩因子按折算代数计算；成功率控制与每代观察回调不适用于异步模式。
+     *          有线程池时所有线程参与；结果依赖线程调度，只有单线程时可复现。
      * 输入参数：
-     *  times：粒子群进化次数
-     *  bestParticalInEachLoop：每一次进化中的最优个体数组，
-     *                          长度为times+1，由外部调用者提供内存空间
+     *  times：折算的最大进化代数
+     *  bestPartical：搜索得到的最优个体
      *  disturbanceRate：粒子速度扰动概率，默认为0.2
-     *  disturbanceVelocityCoe：速度扰动因子，表征扰动速度相对_maxSpeed大小
-     *                          用于扰动粒子速度以提高局部搜索能力，默认为0.05
+     *  disturbanceVelocityCoe：速度扰动因子，默认为0.05
      * 输出参数：void
      ***************************************************************/
-    void findMax(int times, ZPSO_Partical *bestParticalInEachLoop,
-                 double disturbanceRate = 0.2,
-                 double disturbanceVelocityCoe = 0.05)
+    void findMaxAsync(int times, Partical &bestPartical,
+                      double disturbanceRate = 0.2,
+                      double disturbanceVelocityCoe = 0.05)
     {
         this->randomlyInitial();
-        for (int i = 1; i <= times; i++)
+        _generationsUsed = 0;
+        _stopReason = ZPSO_StopReason::MaxGenerations;
+
+        ZPSO_AsyncBest<Real> sharedBest(_dimension);
+        sharedBest.tryImprove(_globalBestPartical._bestFitness, _globalBestPartical._bestPosition.data());
+
+        const int64_t budget = static_cast<int64_t>(times) * _particalCount;
+        std::atomic<int64_t> ticket(0);
+        std::atomic<int64_t> evaluated(0);
+        std::atomic<bool> stopping(budget <= 0);
+        std::atomic<int> stopReason(static_cast<int>(ZPSO_StopReason::MaxGenerations));
+        std::atomic<double> windowBest(sharedBest.fitness());
+        std::atomic<int> stallCount(0);
+        std::unique_ptr<std::atomic<bool>[]> claimed(new std::atomic<bool>[_particalCount]);
+        for (int i = 0; i < _particalCount; i++)
+            claimed[i].store(false, std::memory_order_relaxed);
+
+        // 每个工作线程独立的随机数序列（主序列依次跳跃 2^128 步）与缓冲区
+        struct Worker
         {
-            this->update(disturbanceRate, disturbanceVelocityCoe);
-            bestParticalInEachLoop[i].copy(_globalBestPartical);
+            ZPSO_Random random;
+            Storage globalBest;
+            Storage snapshot;  // tryRead 的临时缓冲区，读到完整快照后才复制到globalBest
+            double globalBestFitness = -INFINITY;
+            typename ZPSO_Storage<D, double>::type disturbanceBuffer;
+            std::vector<double> randomBuffer;
+        };
+        const int workerCount = _threadPool != nullptr ? _threadPool->getThreadCount() : 1;
+        std::vector<Worker> workers(workerCount);
+        for (Worker &worker : workers)
+        {
+            _random.jump();
+            worker.random = _random;
+            ZPSO_Storage<D, Real>::resize(worker.globalBest, _dimension);
+            ZPSO_Storage<D, Real>::resize(worker.snapshot, _dimension);
+            ZPSO_Storage<D, double>::resize(worker.disturbanceBuffer, _dimension);
+            worker.randomBuffer.resize(2 * _dimension);
+        }
+
+        auto stop = [&](ZPSO_StopReason reason)
+        {
+            bool expected = false;
+            if (stopping.compare_exchange_strong(expected, true))
+                stopReason.store(static_cast<int>(reason), std::memory_order_relaxed);
+        };
+        auto work = [&](int w)
+        {
+            Worker &worker = workers[w];
+            while (!stopping.load(std::memory_order_relaxed))
+            {
+                int i = static_cast<int>(ticket.fetch_add(1, std::memory_order_relaxed) % _particalCount);
+                if (claimed[i].exchange(true, std::memory_order_acquire))
+                    continue; // 该粒子正被其他线程处理
+                Partical &partical = _particalSet[i];
+
+                // 依据最近的全局最优更新速度与位置（读到半写快照时沿用上次的副本）
+                double fitness;
+                if (sharedBest.tryRead(worker.snapshot, fitness))
+                {
+                    std::copy(worker.snapshot.begin(), worker.snapshot.end(), worker.globalBest.begin());
+                    worker.globalBestFitness = fitness;
+                }
+                // 惯性权重与收缩因子按折算代数计算
+                double scaleValue, guideValue;
+                controlCoefficients(static_cast<int>(evaluated.load(std::memory_order_relaxed) / _particalCount),
+                                    times, scaleValue, guideValue);
+                const Real velocityScale = static_cast<Real>(scaleValue);
+                const Real globalGuideCoe = static_cast<Real>(_globalGuideCoe * guideValue);
+                const Real localGuideCoe = static_cast<Real>(_localGuideCoe * guideValue);
+                worker.random.fill0_1(worker.randomBuffer.data(), 2 * _dimension);
+                Real velocityMod = 0;
+                ZPSO_Unroll<D>::run(_dimension, [&](int j)
+                                    {
+                    partical._velocity[j] = velocityScale * partical._velocity[j] +
+                                            (globalGuideCoe * static_cast<Real>(worker.randomBuffer[2 * j]) * (worker.globalBest[j] - partical._position[j]) +
+                                             localGuideCoe * static_cast<Real>(worker.randomBuffer[2 * j + 1]) * (partical._bestPosition[j] - partical._position[j]));
+                    velocityMod += partical._velocity[j] * partical._velocity[j]; });
+                limitSpeed(partical, std::sqrt(velocityMod));
+                if (worker.random.rand0_1() < disturbanceRate)
+                    disturbance(partical, disturbanceVelocityCoe, worker.random, worker.disturbanceBuffer);
+                ZPSO_Unroll<D>::run(_dimension, [&](int j)
+                                    {
+                    partical._position[j] += partical._velocity[j];
+                    if (partical._position[j] < _positionMinValue[j])
+                        partical._position[j] = _positionMinValue[j];
+                    else if (partical._position[j] > _positionMaxValue[j])
+                        partical._position[j] = _positionMaxValue[j]; });
+
+                // 评估并立即更新个体最优与共享全局最优
+                if (_fitnessFunction)
+                    partical._fitness = _fitnessFunction(partical);
+                else
+                    _batchFitnessFunction(partical._position.data(), &partical._bestFitness, 1, _dimension,
+                                          &partical._fitness);
+                if (partical._fitness > partical._bestFitness)
+                {
+                    std::copy(partical._position.begin(), partical._position.end(), partical._bestPosition.begin());
+                    partical._bestFitness = partical._fitness;
+                    sharedBest.tryImprove(partical._bestFitness, partical._bestPosition.data());
+                }
+                claimed[i].store(false, std::memory_order_release);
+
+                // 终止条件
+                int64_t count = evaluated.fetch_add(1, std::memory_order_relaxed) + 1;
+                if (count >= budget)
+                    stop(ZPSO_StopReason::MaxGenerations);
+                else if (_stopCriteria.useTargetFitness && sharedBest.fitness() >= _stopCriteria.targetFitness)
+                    stop(ZPSO_StopReason::TargetReached);
+                else if (cancelRequested())
+                    stop(ZPSO_StopReason::Cancelled);
+                else if (deadlineReached())
+                    stop(ZPSO_StopReason::Deadline);
+                else if (_stopCriteria.stallGenerations > 0 && count % _particalCount == 0)
+                {
+                    // 每完成粒子数次评估的线程负责一次停滞判断
+                    double current = sharedBest.fitness();
+                    double previous = windowBest.exchange(current, std::memory_order_relaxed);
+                    double threshold = _stopCriteria.minRelativeImprovement * std::max(fabs(previous), 1.0);
+                    if (current - previous > threshold)
+                        stallCount.store(0, std::memory_order_relaxed);
+                    else if (stallCount.fetch_add(1, std::memory_order_relaxed) + 1 >= _stopCriteria.stallGenerations)
+                        stop(ZPSO_StopReason::Stalled);
+                }
+            }
+        };
+        auto evolutionStart = std::chrono::steady_clock::now();
+        if (_threadPool != nullptr)
+            _threadPool->parallelFor(workerCount, work);
+        else
+            work(0);
+        _evolutionNs = elapsedNs(evolutionStart);
+
+        _stopReason = static_cast<ZPSO_StopReason>(stopReason.load());
+        _generationsUsed = static_cast<int>(evaluated.load() / _particalCount);
+        double fitness;
+        if (sharedBest.tryRead(_globalBestPartical._bestPosition, fitness))
+        {
+            std::copy(_globalBestPartical._bestPosition.begin(), _globalBestPartical._bestPosition.end(),
+                      _globalBestPartical._position.begin());
+            _globalBestPartical._bestFitness = fitness;
+            _globalBestPartical._fitness = fitness;
         }
+        bestPartical.copy(_globalBestPartical);
     }
 };
 
+// 运行时维度、双精度的PSO算法（原有接口）
+using ZPSO_Algorithm = ZPSO_AlgorithmT<0, double>;
+
 #endif // _ZPSOALGORITHM_H
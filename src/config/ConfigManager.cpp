@@ -1,4 +1,6 @@
 #include "config/ConfigManager.h"
+#include "algorithm/IPathPlanningAlgorithm.h"
+#include "PathPostProcessor.h"
 #include <regex>
 #include <sstream>
 #include <algorithm>
@@ -43,9 +45,18 @@ bool ConfigManager::parseJsonFile(const std::string& filepath) {
         } else if (line.find("\"pathPlanning\"") != std::string::npos) {
             currentSection = "pathPlanning";
             continue;
+        } else if (line.find("\"postProcessing\"") != std::string::npos) {
+            currentSection = "postProcessing";
+            continue;
+        } else if (line.find("\"server\"") != std::string::npos) {
+            currentSection = "server";
+            continue;
         } else if (line.find("\"visualization\"") != std::string::npos) {
             currentSection = "visualization";
             continue;
+        } else if (line.find("\"logging\"") != std::string::npos) {
+            currentSection = "logging";
+            continue;
         }
         
         // 解析键值对
@@ -73,12 +84,92 @@ bool ConfigManager::parseJsonFile(const std::string& filepath) {
                     config.pso.localGuideCoe = parseDouble(value);
                 } else if (key == "maxSpeed") {
                     config.pso.maxSpeed = parseDouble(value);
+                } else if (key == "randomSeed") {
+                    config.pso.randomSeed = parseUInt64(value);
+                } else if (key == "threadCount") {
+                    config.pso.threadCount = parseInt(value);
+                } else if (key == "batchFitness") {
+                    config.pso.batchFitness = parseInt(value);
+                } else if (key == "stallGenerations") {
+                    config.pso.stallGenerations = parseInt(value);
+                } else if (key == "improvementThreshold") {
+                    config.pso.improvementThreshold = parseDouble(value);
+                } else if (key == "minSwarmDiameter") {
+                    config.pso.minSwarmDiameter = parseDouble(value);
+                } else if (key == "islandCount") {
+                    config.pso.islandCount = parseInt(value);
+                } else if (key == "migrationInterval") {
+                    config.pso.migrationInterval = parseInt(value);
+                } else if (key == "migrationSize") {
+                    config.pso.migrationSize = parseInt(value);
+                } else if (key == "migrationTopology") {
+                    config.pso.migrationTopology = parseInt(value);
+                } else if (key == "guidedInit") {
+                    config.pso.guidedInit = parseInt(value);
+                } else if (key == "initJitter") {
+                    config.pso.initJitter = parseDouble(value);
+                } else if (key == "randomInitFraction") {
+                    config.pso.randomInitFraction = parseDouble(value);
+                } else if (key == "corridorMargin") {
+                    config.pso.corridorMargin = parseDouble(value);
+                } else if (key == "distanceFieldResolution") {
+                    config.pso.distanceFieldResolution = parseDouble(value);
+                } else if (key == "collisionCacheSize") {
+                    config.pso.collisionCacheSize = parseInt(value);
+                } else if (key == "lazyEvaluation") {
+                    config.pso.lazyEvaluation = parseInt(value);
+                } else if (key == "staticDimension") {
+                    config.pso.staticDimension = parseInt(value);
+                } else if (key == "useFloat") {
+                    config.pso.useFloat = parseInt(value);
+                } else if (key == "asyncMode") {
+                    config.pso.asyncMode = parseInt(value);
+                } else if (key == "parameterControl") {
+                    config.pso.parameterControl = parseInt(value);
+                } else if (key == "inertiaStart") {
+                    config.pso.inertiaStart = parseDouble(value);
+                } else if (key == "inertiaEnd") {
+                    config.pso.inertiaEnd = parseDouble(value);
+                } else if (key == "traceCapacity") {
+                    config.pso.traceCapacity = parseInt(value);
+                } else if (key == "replanGenerations") {
+                    config.pso.replanGenerations = parseInt(value);
                 }
             } else if (currentSection == "pathPlanning") {
                 if (key == "numWaypoints") {
                     config.pathPlanning.numWaypoints = parseInt(value);
                 } else if (key == "mapCellSize") {
                     config.pathPlanning.mapCellSize = parseDouble(value);
+                } else if (key == "adaptiveWaypoints") {
+                    config.pathPlanning.adaptiveWaypoints = parseInt(value);
+                } else if (key == "minWaypoints") {
+                    config.pathPlanning.minWaypoints = parseInt(value);
+                } else if (key == "maxWaypoints") {
+                    config.pathPlanning.maxWaypoints = parseInt(value);
+                } else if (key == "waypointsPerTurn") {
+                    config.pathPlanning.waypointsPerTurn = parseDouble(value);
+                } else if (key == "turnAngleThreshold") {
+                    config.pathPlanning.turnAngleThreshold = parseDouble(value);
+                }
+            } else if (currentSection == "postProcessing") {
+                if (key == "enabled") {
+                    config.postProcessing.enabled = parseInt(value);
+                } else if (key == "shortcut") {
+                    config.postProcessing.shortcut = parseInt(value);
+                } else if (key == "smoothing") {
+                    config.postProcessing.smoothing = parseInt(value);
+                } else if (key == "sampleSpacing") {
+                    config.postProcessing.sampleSpacing = parseDouble(value);
+                } else if (key == "maxCurvature") {
+                    config.postProcessing.maxCurvature = parseDouble(value);
+                }
+            } else if (currentSection == "server") {
+                if (key == "workers") {
+                    config.server.workers = parseInt(value);
+                } else if (key == "planThreads") {
+                    config.server.planThreads = parseInt(value);
+                } else if (key == "queueCapacity") {
+                    config.server.queueCapacity = parseInt(value);
                 }
             } else if (currentSection == "visualization") {
                 if (key == "windowWidth") {
@@ -88,6 +179,11 @@ bool ConfigManager::parseJsonFile(const std::string& filepath) {
                 } else if (key == "frameRate") {
                     config.visualization.frameRate = parseInt(value);
                 }
+            } else if (currentSection == "logging") {
+                if (key == "level") {
+                    value.erase(std::remove(value.begin(), value.end(), '\"'), value.end());
+                    config.logging.level = value;
+                }
             }
         }
     }
@@ -119,6 +215,14 @@ int ConfigManager::parseInt(const std::string& value) {
     }
 }
 
+uint64_t ConfigManager::parseUInt64(const std::string& value) {
+    try {
+        return std::stoull(value);
+    } catch (const std::exception&) {
+        return 0;
+    }
+}
+
 void ConfigManager::printConfig() const {
     std::cout << "\n=== 当前配置 ===" << std::endl;
     std::cout << "PSO参数:" << std::endl;
@@ -127,13 +231,104 @@ void ConfigManager::printConfig() const {
     std::cout << "  全局引导系数: " << config.pso.globalGuideCoe << std::endl;
     std::cout << "  局部引导系数: " << config.pso.localGuideCoe << std::endl;
     std::cout << "  最大速度: " << config.pso.maxSpeed << std::endl;
+    std::cout << "  随机种子: " << config.pso.randomSeed << std::endl;
+    std::cout << "  评估线程数: " << config.pso.threadCount << std::endl;
+    std::cout << "  批量评估: " << (config.pso.batchFitness ? "是" : "否") << std::endl;
+    std::cout << "  停滞代数上限: " << config.pso.stallGenerations << std::endl;
+    std::cout << "  相对改进阈值: " << config.pso.improvementThreshold << std::endl;
+    std::cout << "  粒子群直径下限: " << config.pso.minSwarmDiameter << std::endl;
+    std::cout << "  岛屿数: " << config.pso.islandCount << std::endl;
+    std::cout << "  迁移间隔: " << config.pso.migrationInterval << std::endl;
+    std::cout << "  迁移精英数: " << config.pso.migrationSize << std::endl;
+    std::cout << "  迁移拓扑: " << (config.pso.migrationTopology == 1 ? "随机" : "环形") << std::endl;
+    std::cout << "  引导初始化: " << (config.pso.guidedInit ? "是" : "否") << std::endl;
+    std::cout << "  初始化扰动标准差: " << config.pso.initJitter << std::endl;
+    std::cout << "  随机初始化比例: " << config.pso.randomInitFraction << std::endl;
+    std::cout << "  走廊外扩距离: " << config.pso.corridorMargin << std::endl;
+    std::cout << "  距离场网格间距: " << config.pso.distanceFieldResolution << std::endl;
+    std::cout << "  碰撞缓存槽位数: " << config.pso.collisionCacheSize << std::endl;
+    std::cout << "  惰性评估: " << (config.pso.lazyEvaluation ? "是" : "否") << std::endl;
+    std::cout << "  编译期维度特化: " << (config.pso.staticDimension ? "是" : "否") << std::endl;
+    std::cout << "  单精度粒子: " << (config.pso.useFloat ? "是" : "否") << std::endl;
+    std::cout << "  异步进化: " << (config.pso.asyncMode ? "是" : "否") << std::endl;
+    std::cout << "  参数控制: " << config.pso.parameterControl
+              << " (惯性权重 " << config.pso.inertiaStart << " -> " << config.pso.inertiaEnd << ")" << std::endl;
+    std::cout << "  收敛记录容量: " << config.pso.traceCapacity << std::endl;
+    std::cout << "  重新规划代数: " << config.pso.replanGenerations << std::endl;
     
     std::cout << "路径规划参数:" << std::endl;
     std::cout << "  中间航点数量: " << config.pathPlanning.numWaypoints << std::endl;
     std::cout << "  地图单元格大小: " << config.pathPlanning.mapCellSize << std::endl;
+    std::cout << "  自适应航点数: " << (config.pathPlanning.adaptiveWaypoints ? "是" : "否")
+              << " (" << config.pathPlanning.minWaypoints << " ~ " << config.pathPlanning.maxWaypoints
+              << ", 每个拐点 " << config.pathPlanning.waypointsPerTurn << " 个, 拐点转角 >= "
+              << config.pathPlanning.turnAngleThreshold << " 度)" << std::endl;
+    
+    std::cout << "路径后处理参数:" << std::endl;
+    std::cout << "  启用: " << (config.postProcessing.enabled ? "是" : "否") << std::endl;
+    std::cout << "  视线捷径: " << (config.postProcessing.shortcut ? "是" : "否") << std::endl;
+    std::cout << "  样条平滑: " << (config.postProcessing.smoothing ? "是" : "否") << std::endl;
+    std::cout << "  采样弧长间距: " << config.postProcessing.sampleSpacing << std::endl;
+    std::cout << "  曲率上限: " << config.postProcessing.maxCurvature << std::endl;
+    
+    std::cout << "规划服务参数:" << std::endl;
+    std::cout << "  工作线程数: " << config.server.workers << std::endl;
+    std::cout << "  每次规划评估线程数: " << config.server.planThreads << std::endl;
+    std::cout << "  请求队列容量: " << config.server.queueCapacity << std::endl;
     
     std::cout << "可视化参数:" << std::endl;
     std::cout << "  窗口宽度: " << config.visualization.windowWidth << std::endl;
     std::cout << "  窗口高度: " << config.visualization.windowHeight << std::endl;
     std::cout << "  帧率: " << config.visualization.frameRate << std::endl;
-} 
\ No newline at end of file
+    
+    std::cout << "日志参数:" << std::endl;
+    std::cout << "  日志级别: " << config.logging.level << std::endl;
+} 
+
+void configureAlgorithm(const AppConfig& config, IPathPlanningAlgorithm& algorithm) {
+    if (config.pso.islandCount > 1) {
+        algorithm.setParameter("islandCount", config.pso.islandCount);
+        algorithm.setParameter("migrationInterval", config.pso.migrationInterval);
+        algorithm.setParameter("migrationSize", config.pso.migrationSize);
+        algorithm.setParameter("migrationTopology", config.pso.migrationTopology);
+    }
+    algorithm.setParameter("generations", config.pso.generations);
+    algorithm.setParameter("particleCount", config.pso.particleCount);
+    algorithm.setParameter("globalGuideCoe", config.pso.globalGuideCoe);
+    algorithm.setParameter("localGuideCoe", config.pso.localGuideCoe);
+    algorithm.setParameter("maxSpeed", config.pso.maxSpeed);
+    algorithm.setParameter("threadCount", config.pso.threadCount);
+    algorithm.setParameter("batchFitness", config.pso.batchFitness);
+    algorithm.setParameter("stallGenerations", config.pso.stallGenerations);
+    algorithm.setParameter("improvementThreshold", config.pso.improvementThreshold);
+    algorithm.setParameter("minSwarmDiameter", config.pso.minSwarmDiameter);
+    algorithm.setParameter("guidedInit", config.pso.guidedInit);
+    algorithm.setParameter("initJitter", config.pso.initJitter);
+    algorithm.setParameter("randomInitFraction", config.pso.randomInitFraction);
+    algorithm.setParameter("corridorMargin", config.pso.corridorMargin);
+    algorithm.setParameter("distanceFieldResolution", config.pso.distanceFieldResolution);
+    algorithm.setParameter("collisionCacheSize", config.pso.collisionCacheSize);
+    algorithm.setParameter("lazyEvaluation", config.pso.lazyEvaluation);
+    algorithm.setParameter("staticDimension", config.pso.staticDimension);
+    algorithm.setParameter("useFloat", config.pso.useFloat);
+    algorithm.setParameter("asyncMode", config.pso.asyncMode);
+    algorithm.setParameter("parameterControl", config.pso.parameterControl);
+    algorithm.setParameter("inertiaStart", config.pso.inertiaStart);
+    algorithm.setParameter("inertiaEnd", config.pso.inertiaEnd);
+    algorithm.setParameter("traceCapacity", config.pso.traceCapacity);
+    algorithm.setParameter("replanGenerations", config.pso.replanGenerations);
+    algorithm.setParameter("adaptiveWaypoints", config.pathPlanning.adaptiveWaypoints);
+    algorithm.setParameter("minWaypoints", config.pathPlanning.minWaypoints);
+    algorithm.setParameter("maxWaypoints", config.pathPlanning.maxWaypoints);
+    algorithm.setParameter("waypointsPerTurn", config.pathPlanning.waypointsPerTurn);
+    algorithm.setParameter("turnAngleThreshold", config.pathPlanning.turnAngleThreshold);
+}
+
+PostProcessingOptions postProcessingOptions(const AppConfig& config) {
+    PostProcessingOptions options;
+    options.shortcut = config.postProcessing.shortcut != 0;
+    options.smoothing = config.postProcessing.smoothing != 0;
+    options.sampleSpacing = config.postProcessing.sampleSpacing;
+    options.maxCurvature = config.postProcessing.maxCurvature;
+    return options;
+}
@@ -0,0 +1,148 @@
+#include "Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstring>
+
+Logger::Logger(size_t capacity, std::FILE* output)
+    : writePosition(0), readPosition(0), droppedMessages(0),
+      runtimeLevel(static_cast<int>(LogLevel::Info)), sink(output),
+      writerSleeping(false), writtenPosition(0), stopping(false) {
+    // 容量取不小于 capacity 的2的幂，便于用掩码取槽位
+    size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+    mask = size - 1;
+    slots.reset(new Slot[size]);
+    for (size_t i = 0; i < size; i++) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    writer = std::thread(&Logger::writerLoop, this);
+}
+
+Logger::~Logger() {
+    {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        stopping = true;
+    }
+    wakeCondition.notify_one();
+    writer.join();
+}
+
+Logger& Logger::instance() {
+    static Logger logger;
+    return logger;
+}
+
+bool Logger::log(LogLevel level, const char* text, size_t length) {
+    uint64_t position = writePosition.load(std::memory_order_relaxed);
+    Slot* slot;
+    for (;;) {
+        slot = &slots[position & mask];
+        uint64_t sequence = slot->sequence.load(std::memory_order_acquire);
+        int64_t difference = static_cast<int64_t>(sequence - position);
+        if (difference == 0) {
+            if (writePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // 写线程还没取走一整圈之前的消息：队列已满
+            droppedMessages.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            position = writePosition.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->level = level;
+    slot->length = static_cast<uint32_t>(length < MESSAGE_SIZE ? length : MESSAGE_SIZE);
+    std::memcpy(slot->text, text, slot->length);
+    // 发布与检查休眠标志都用顺序一致序，与写线程“置休眠标志后再检查槽位”配对，避免丢失唤醒
+    slot->sequence.store(position + 1, std::memory_order_seq_cst);
+
+    // 写线程已休眠时才需要加锁唤醒，连续输出时不进入互斥区
+    if (writerSleeping.load(std::memory_order_seq_cst)) {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wakeCondition.notify_one();
+    }
+    return true;
+}
+
+size_t Logger::drain() {
+    size_t written = 0;
+    std::FILE* output = sink.load(std::memory_order_relaxed);
+    for (;;) {
+        Slot& slot = slots[readPosition & mask];
+        if (slot.sequence.load(std::memory_order_acquire) != readPosition + 1) {
+            break;
+        }
+        std::fprintf(output, "[%s] %.*s\n", levelName(slot.level), static_cast<int>(slot.length), slot.text);
+        slot.sequence.store(readPosition + mask + 1, std::memory_order_release);
+        readPosition++;
+        written++;
+    }
+    if (written > 0) {
+        std::fflush(output);
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex);
+            writtenPosition.store(readPosition, std::memory_order_release);
+        }
+        drainedCondition.notify_all();
+    }
+    return written;
+}
+
+void Logger::writerLoop() {
+    for (;;) {
+        if (drain() > 0) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        if (stopping) {
+            lock.unlock();
+            drain();
+            return;
+        }
+        writerSleeping.store(true, std::memory_order_seq_cst);
+        // 超时只是兜底，正常情况下由生产者唤醒
+        wakeCondition.wait_for(lock, std::chrono::milliseconds(50), [&] {
+            return stopping || slots[readPosition & mask].sequence.load(std::memory_order_seq_cst) == readPosition + 1;
+        });
+        writerSleeping.store(false, std::memory_order_relaxed);
+    }
+}
+
+void Logger::flush() {
+    uint64_t target = writePosition.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(wakeMutex);
+    wakeCondition.notify_one();
+    drainedCondition.wait(lock, [&] { return writtenPosition.load(std::memory_order_acquire) >= target; });
+}
+
+bool Logger::parseLevel(const std::string& name, LogLevel& level) {
+    static const LogLevel levels[] = {LogLevel::Trace, LogLevel::Debug, LogLevel::Info,
+                                      LogLevel::Warn, LogLevel::Error, LogLevel::Off};
+    for (LogLevel candidate : levels) {
+        const char* candidateName = levelName(candidate);
+        if (name.size() == std::strlen(candidateName) &&
+            std::equal(name.begin(), name.end(), candidateName,
+                       [](char a, char b) { return std::toupper(static_cast<unsigned char>(a)) == b; })) {
+            level = candidate;
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* Logger::levelName(LogLevel level) {
+    switch (level) {
+        case LogLevel::Trace: return "TRACE";
+        case LogLevel::Debug: return "DEBUG";
+        case LogLevel::Info: return "INFO";
+        case LogLevel::Warn: return "WARN";
+        case LogLevel::Error: return "ERROR";
+        case LogLevel::Off: return "OFF";
+    }
+    return "UNKNOWN";
+}
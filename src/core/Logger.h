@@ -0,0 +1,193 @@
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+
+/**
+ * @brief 日志级别（数值越大越严重）
+ */
+enum class LogLevel : int {
+    Trace = 0,
+    Debug = 1,
+    Info = 2,
+    Warn = 3,
+    Error = 4,
+    Off = 5
+};
+
+// 编译期最低日志级别：低于该级别的日志宏展开为空语句，参数表达式不会被求值
+#ifndef ROBONAV_LOG_LEVEL
+#define ROBONAV_LOG_LEVEL 2
+#endif
+
+/**
+ * @brief 分级异步日志
+ *
+ * 调用线程只把格式化好的一行写入定长槽位的无锁环形队列（多生产者单消费者），
+ * 由后台写线程批量写出并在每批结束时刷新一次，规划线程不会因输出而阻塞。
+ * 队列满时丢弃新消息并计数，而不是等待写线程。
+ * 写出使用 C 标准输出流（默认 stdout），stdio 自身保证每次写出的原子性。
+ */
+class Logger {
+public:
+    static constexpr size_t MESSAGE_SIZE = 248;  // 单条消息最大字节数（超出部分截断）
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+private:
+    struct Slot {
+        std::atomic<uint64_t> sequence;  // 槽位状态：等于写位置时可写，等于写位置+1时可读
+        LogLevel level;
+        uint32_t length;
+        char text[MESSAGE_SIZE];
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    size_t mask;
+    alignas(64) std::atomic<uint64_t> writePosition;
+    alignas(64) uint64_t readPosition;       // 只由写线程访问
+    std::atomic<uint64_t> droppedMessages;
+    std::atomic<int> runtimeLevel;
+
+    std::atomic<std::FILE*> sink;
+    std::mutex wakeMutex;
+    std::condition_variable wakeCondition;
+    std::condition_variable drainedCondition;
+    std::atomic<bool> writerSleeping;
+    std::atomic<uint64_t> writtenPosition;   // 已写出的消息位置（flush 等待用）
+    bool stopping;
+    std::thread writer;
+
+    void writerLoop();
+    size_t drain();
+
+public:
+    explicit Logger(size_t capacity = DEFAULT_CAPACITY, std::FILE* output = stdout);
+    ~Logger();
+
+    Logger(const Logger&) = delete;
+    Logger& operator=(const Logger&) = delete;
+
+    /**
+     * @brief 进程级日志实例（首次使用时创建写线程）
+     */
+    static Logger& instance();
+
+    /**
+     * @brief 运行期日志级别，低于该级别的消息不格式化也不入队
+     */
+    void setLevel(LogLevel level) { runtimeLevel.store(static_cast<int>(level), std::memory_order_relaxed); }
+    LogLevel getLevel() const { return static_cast<LogLevel>(runtimeLevel.load(std::memory_order_relaxed)); }
+    bool isEnabled(LogLevel level) const {
+        return static_cast<int>(level) >= runtimeLevel.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief 切换输出流（如标准输出用作协议通道时改写到 stderr），此后写出的批次使用新的输出流
+     */
+    void setOutput(std::FILE* output) { sink.store(output, std::memory_order_relaxed); }
+
+    /**
+     * @brief 写入一条消息（不阻塞，队列满时丢弃）
+     * @return 是否成功入队
+     */
+    bool log(LogLevel level, const char* text, size_t length);
+
+    /**
+     * @brief 等待此前入队的消息全部写出
+     */
+    void flush();
+
+    /**
+     * @brief 因队列满而丢弃的消息数
+     */
+    uint64_t dropped() const { return droppedMessages.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief 由名称解析日志级别（trace/debug/info/warn/error/off）
+     */
+    static bool parseLevel(const std::string& name, LogLevel& level);
+    static const char* levelName(LogLevel level);
+};
+
+/**
+ * @brief 日志宏使用的定长格式化流
+ *
+ * 每个线程复用一个实例，格式化写入定长缓冲区，超出部分截断，不产生堆分配。
+ */
+class LogLineStream : private std::streambuf, public std::ostream {
+private:
+    char buffer[Logger::MESSAGE_SIZE];
+
+public:
+    LogLineStream() : std::ostream(static_cast<std::streambuf*>(this)) { reset(); }
+
+    void reset() {
+        setp(buffer, buffer + sizeof(buffer));
+        clear();
+    }
+    const char* data() const { return buffer; }
+    size_t length() const { return static_cast<size_t>(pptr() - pbase()); }
+
+protected:
+    std::streambuf::int_type overflow(std::streambuf::int_type) override {
+        return std::streambuf::traits_type::eof();
+    }
+
+public:
+    static LogLineStream& local() {
+        thread_local LogLineStream stream;
+        stream.reset();
+        return stream;
+    }
+};
+
+#define ROBONAV_LOG_AT(level, message)                                       \
+    do {                                                                     \
+        Logger& robonavLogger_ = Logger::instance();                         \
+        if (robonavLogger_.isEnabled(level)) {                               \
+            LogLineStream& robonavLine_ = LogLineStream::local();            \
+            robonavLine_ << message;                                         \
+            robonavLogger_.log(level, robonavLine_.data(), robonavLine_.length()); \
+        }                                                                    \
+    } while (0)
+
+#if ROBONAV_LOG_LEVEL <= 0
+#define LOG_TRACE(message) ROBONAV_LOG_AT(LogLevel::Trace, message)
+#else
+#define LOG_TRACE(message) ((void)0)
+#endif
+
+#if ROBONAV_LOG_LEVEL <= 1
+#define LOG_DEBUG(message) ROBONAV_LOG_AT(LogLevel::Debug, message)
+#else
+#define LOG_DEBUG(message) ((void)0)
+#endif
+
+#if ROBONAV_LOG_LEVEL <= 2
+#define LOG_INFO(message) ROBONAV_LOG_AT(LogLevel::Info, message)
+#else
+#define LOG_INFO(message) ((void)0)
+#endif
+
+#if ROBONAV_LOG_LEVEL <= 3
+#define LOG_WARN(message) ROBONAV_LOG_AT(LogLevel::Warn, message)
+#else
+#define LOG_WARN(message) ((void)0)
+#endif
+
+#if ROBONAV_LOG_LEVEL <= 4
+#define LOG_ERROR(message) ROBONAV_LOG_AT(LogLevel::Error, message)
+#else
+#define LOG_ERROR(message) ((void)0)
+#endif
+
+#endif // LOGGER_H
@@ -78,6 +78,11 @@ bool Map::isObstacle(double x, double y) const {
 }
 
 bool Map::isLineColliding(const Point& start, const Point& end) const {
+    uint64_t cellsTraversed = 0;
+    return isLineColliding(start, end, cellsTraversed);
+}
+
+bool Map::isLineColliding(const Point& start, const Point& end, uint64_t& cellsTraversed) const {
     int x0 = static_cast<int>(start.x / cellSize);
     int y0 = static_cast<int>(start.y / cellSize);
     int x1 = static_cast<int>(end.x / cellSize);
@@ -96,6 +101,7 @@ bool Map::isLineColliding(const Point& start, const Point& end) const {
     dy *= 2;
 
     for (; n > 0; --n) {
+        cellsTraversed++;
         // 检查当前点是否为障碍物
         if (x >= 0 && x < width && y >= 0 && y < height) {
             if (grid[y][x] == 1) {
@@ -6,6 +6,7 @@
 #include <fstream>
 #include <iostream>
 #include <cmath>
+#include <cstdint>
 #include "../../include/Common.h"
 
 class Map {
@@ -33,6 +34,9 @@ public:
     // Bresenham直线算法检查线段是否与障碍物碰撞
     bool isLineColliding(const Point& start, const Point& end) const;
 
+    // 同上，并将检查过的网格数累加到 cellsTraversed
+    bool isLineColliding(const Point& start, const Point& end, uint64_t& cellsTraversed) const;
+
     // 获取地图尺寸
     int getWidth() const;
     int getHeight() const;
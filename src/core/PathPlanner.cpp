@@ -1,16 +1,13 @@
 #include "PathPlanner.h"
 
-// 静态成员变量定义
-PathPlanner* PathPlanner::currentPlanner = nullptr;
-
 // 构造函数实现
 PathPlanner::PathPlanner(Map* m, const Point& start, const Point& end, 
                          std::unique_ptr<IPathPlanningAlgorithm> algo,
                          int waypoints) 
     : map(m), startPoint(start), endPoint(end), 
-      numWaypoints(waypoints), algorithm(std::move(algo)),
+      numWaypoints(waypoints), randomSeed(1), hasLastResult(false), postProcessingEnabled(false),
+      algorithm(std::move(algo)),
       evaluator(m) {
-    currentPlanner = this;
 }
 
 // 设置起点和终点
@@ -19,6 +16,11 @@ void PathPlanner::setStartEnd(const Point& start, const Point& end) {
     endPoint = end;
 }
 
+// 设置随机种子
+void PathPlanner::setRandomSeed(uint64_t seed) {
+    randomSeed = seed;
+}
+
 // 切换算法（策略模式）
 void PathPlanner::setAlgorithm(std::unique_ptr<IPathPlanningAlgorithm> algo) {
     algorithm = std::move(algo);
@@ -29,30 +31,133 @@ std::string PathPlanner::getCurrentAlgorithmName() const {
     return algorithm ? algorithm->getAlgorithmName() : "None";
 }
 
-// 执行路径规划 - 现在通过抽象接口调用
-PathPlanningResult PathPlanner::planPath() {
-    if (!algorithm) {
-        return {std::vector<Point>(), 0.0, 0.0, false, 0.0, "None"};
+// 设置路径后处理
+void PathPlanner::setPostProcessing(bool enabled, const PostProcessingOptions& options) {
+    postProcessingEnabled = enabled;
+    postProcessor.setOptions(options);
+}
+
+bool PathPlanner::isPostProcessingEnabled() const {
+    return postProcessingEnabled;
+}
+
+// 后处理成功的规划结果
+void PathPlanner::applyPostProcessing(PathPlanningResult& result, const Map* targetMap) const {
+    if (postProcessingEnabled && targetMap) {
+        postProcessor.apply(*targetMap, result);
     }
-    
-    // 构造请求
+}
+
+// 构造规划请求
+PathPlanningRequest PathPlanner::buildRequest(const CancellationToken* cancellation,
+                                              PlanningProgressCallback progress) const {
     PathPlanningRequest request;
     request.startPoint = startPoint;
     request.endPoint = endPoint;
     request.map = map;
     request.numWaypoints = numWaypoints;
     request.maxTime = 30.0; // 默认30秒超时
+    request.randomSeed = randomSeed;
+    request.cancellation = cancellation;
+    request.progress = std::move(progress);
+    return request;
+}
+
+// 执行路径规划 - 现在通过抽象接口调用
+PathPlanningResult PathPlanner::planPath(const CancellationToken* cancellation, PlanningProgressCallback progress) {
+    if (!algorithm) {
+        return {std::vector<Point>(), 0.0, 0.0, false, 0.0, "None"};
+    }
     
     // 执行规划
-    auto result = algorithm->planPath(request);
+    auto result = algorithm->planPath(buildRequest(cancellation, std::move(progress)));
     
     if (result.success) {
+        lastResult = result;
+        hasLastResult = true;
+        applyPostProcessing(result, map);
         bestPath = result.path;
     }
     
     return result;
 }
 
+// 起点前移后热启动重新规划
+PathPlanningResult PathPlanner::replan(const Point& newStart, const CancellationToken* cancellation,
+                                       PlanningProgressCallback progress) {
+    startPoint = newStart;
+    if (!hasLastResult) {
+        return planPath(cancellation, std::move(progress));
+    }
+    if (!algorithm) {
+        return {std::vector<Point>(), 0.0, 0.0, false, 0.0, "None"};
+    }
+    
+    auto result = algorithm->replanPath(buildRequest(cancellation, std::move(progress)), lastResult);
+    
+    if (result.success) {
+        lastResult = result;
+        applyPostProcessing(result, map);
+        bestPath = result.path;
+    }
+    
+    return result;
+}
+
+// 配置批量规划
+void PathPlanner::setBatchAlgorithmFactory(AlgorithmFactory factory, int threadCount) {
+    batchAlgorithms.clear();
+    batchPool.reset();
+    if (!factory) {
+        return;
+    }
+    
+    batchPool = std::make_unique<ThreadPool>(threadCount);
+    // 实例在调用线程上一次性创建，工厂本身无需线程安全
+    for (int i = 0; i < batchPool->getThreadCount(); i++) {
+        batchAlgorithms.push_back(factory());
+    }
+}
+
+int PathPlanner::getBatchThreadCount() const {
+    return batchPool ? batchPool->getThreadCount() : 1;
+}
+
+// 批量规划
+std::vector<PathPlanningResult> PathPlanner::planBatch(const PathPlanningRequest* requests, size_t count) {
+    std::vector<PathPlanningResult> results(count);
+    
+    auto planOne = [&](IPathPlanningAlgorithm* solver, size_t index) {
+        if (!solver) {
+            results[index] = {std::vector<Point>(), 0.0, 0.0, false, 0.0, "None"};
+            return;
+        }
+        PathPlanningRequest request = requests[index];
+        if (!request.map) {
+            request.map = map;
+        }
+        results[index] = solver->planPath(request);
+        applyPostProcessing(results[index], request.map);
+    };
+    
+    if (!batchPool) {
+        for (size_t i = 0; i < count; i++) {
+            planOne(algorithm.get(), i);
+        }
+        return results;
+    }
+    
+    // 线程按原子计数器领取下一个请求，耗时悬殊的请求也能均衡分配
+    batchPool->parallelForWorker(static_cast<int>(count), [&](int index, int worker) {
+        planOne(batchAlgorithms[worker].get(), static_cast<size_t>(index));
+    });
+    return results;
+}
+
+std::vector<PathPlanningResult> PathPlanner::planBatch(const std::vector<PathPlanningRequest>& requests) {
+    return planBatch(requests.data(), requests.size());
+}
+
 // 路径质量分析方法
 double PathPlanner::calculatePathLength(const std::vector<Point>& path) const {
     return evaluator.calculatePathLength(path);
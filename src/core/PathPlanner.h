@@ -4,23 +4,41 @@
 #include "../../include/Common.h"
 #include "../../include/algorithm/IPathPlanningAlgorithm.h"
 #include "Map.h"
+#include "PathPostProcessor.h"
+#include "ThreadPool.h"
 #include <vector>
 #include <memory>
 #include <chrono>
+#include <functional>
 
 class PathPlanner {
+public:
+    // 批量规划时为每个工作线程创建独立算法实例的工厂
+    using AlgorithmFactory = std::function<std::unique_ptr<IPathPlanningAlgorithm>()>;
+
 private:
     Map* map;
     Point startPoint;
     Point endPoint;
     int numWaypoints;
+    uint64_t randomSeed;
     std::vector<Point> bestPath;
     
+    // 上一次成功规划的结果（后处理之前，供 replan 热启动）
+    PathPlanningResult lastResult;
+    bool hasLastResult;
+    
+    // 路径后处理（捷径与样条平滑），默认关闭
+    bool postProcessingEnabled;
+    PathPostProcessor postProcessor;
+    
     // 算法策略：使用抽象接口而非具体实现
     std::unique_ptr<IPathPlanningAlgorithm> algorithm;
     
-    // 静态成员变量
-    static PathPlanner* currentPlanner;
+    // 批量规划：常驻线程池，每个线程独占一个算法实例（跨批次复用）
+    std::unique_ptr<ThreadPool> batchPool;
+    std::vector<std::unique_ptr<IPathPlanningAlgorithm>> batchAlgorithms;
+
     
     // 路径评估器（独立于算法）
     class PathEvaluator {
@@ -76,6 +94,12 @@ private:
     };
     
     PathEvaluator evaluator;
+    
+    // 由当前起终点与设置构造规划请求
+    PathPlanningRequest buildRequest(const CancellationToken* cancellation, PlanningProgressCallback progress) const;
+    
+    // 对成功的规划结果做后处理，更新路径长度与后处理统计
+    void applyPostProcessing(PathPlanningResult& result, const Map* targetMap) const;
 
 public:
     // 构造函数：接受算法策略
@@ -86,14 +110,38 @@ public:
     // 设置起点和终点
     void setStartEnd(const Point& start, const Point& end);
     
+    // 设置随机种子（用于复现规划结果）
+    void setRandomSeed(uint64_t seed);
+    
     // 切换算法（策略模式）
     void setAlgorithm(std::unique_ptr<IPathPlanningAlgorithm> algo);
     
     // 获取当前算法信息
     std::string getCurrentAlgorithmName() const;
+    
+    // 设置路径后处理：开启后 planPath/replan/planBatch 返回后处理过的路径（适应度仍为算法给出的值）
+    void setPostProcessing(bool enabled, const PostProcessingOptions& options = PostProcessingOptions());
+    bool isPostProcessingEnabled() const;
 
     // 执行路径规划 - 现在通过抽象接口调用
-    PathPlanningResult planPath();
+    // cancellation 可在其他线程取消本次规划（返回当前最优路径），progress 接收规划进度
+    PathPlanningResult planPath(const CancellationToken* cancellation = nullptr,
+                                PlanningProgressCallback progress = nullptr);
+    
+    // 起点前移后重新规划：以上一次成功规划的结果热启动（没有时等同于 planPath）
+    PathPlanningResult replan(const Point& newStart, const CancellationToken* cancellation = nullptr,
+                              PlanningProgressCallback progress = nullptr);
+    
+    // 配置批量规划：threadCount 为参与计算的总线程数（<=0 取硬件并发数），factory 为空时关闭
+    void setBatchAlgorithmFactory(AlgorithmFactory factory, int threadCount = 0);
+    
+    // 批量规划：请求并发执行，结果按请求顺序返回；map 为空的请求使用规划器的地图
+    // 未配置工厂时使用当前算法逐个串行规划
+    std::vector<PathPlanningResult> planBatch(const PathPlanningRequest* requests, size_t count);
+    std::vector<PathPlanningResult> planBatch(const std::vector<PathPlanningRequest>& requests);
+    
+    // 批量规划使用的线程数（未配置时为1）
+    int getBatchThreadCount() const;
     
     // 路径质量分析方法
     double calculatePathLength(const std::vector<Point>& path) const;
@@ -0,0 +1,200 @@
+#include "PathPostProcessor.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace {
+
+Point scaled(const Point& p, double s) {
+    return Point(p.x * s, p.y * s);
+}
+
+// 单位方向向量（零向量返回零）
+Point direction(const Point& from, const Point& to) {
+    double length = from.distanceTo(to);
+    return length > Constants::EPSILON ? scaled(to - from, 1.0 / length) : Point();
+}
+
+// 三次 Hermite 曲线：端点 p0/p1，切线 m0/m1
+struct HermiteSpan {
+    Point p0, m0, p1, m1;
+
+    Point at(double t) const {
+        double t2 = t * t, t3 = t2 * t;
+        return scaled(p0, 2 * t3 - 3 * t2 + 1) + scaled(m0, t3 - 2 * t2 + t) +
+               scaled(p1, -2 * t3 + 3 * t2) + scaled(m1, t3 - t2);
+    }
+
+    // 曲率绝对值；速度接近零时返回 0
+    double curvature(double t) const {
+        double t2 = t * t;
+        Point d1 = scaled(p0, 6 * t2 - 6 * t) + scaled(m0, 3 * t2 - 4 * t + 1) +
+                   scaled(p1, -6 * t2 + 6 * t) + scaled(m1, 3 * t2 - 2 * t);
+        Point d2 = scaled(p0, 12 * t - 6) + scaled(m0, 6 * t - 4) +
+                   scaled(p1, -12 * t + 6) + scaled(m1, 6 * t - 2);
+        double speed = std::sqrt(d1.x * d1.x + d1.y * d1.y);
+        if (speed < 1e-9) {
+            return 0.0;
+        }
+        return std::fabs(d1.x * d2.y - d1.y * d2.x) / (speed * speed * speed);
+    }
+};
+
+} // namespace
+
+PathPostProcessor::PathPostProcessor(const PostProcessingOptions& opts) : options(opts) {
+}
+
+void PathPostProcessor::setOptions(const PostProcessingOptions& opts) {
+    options = opts;
+}
+
+const PostProcessingOptions& PathPostProcessor::getOptions() const {
+    return options;
+}
+
+std::vector<Point> PathPostProcessor::process(const Map& map, const std::vector<Point>& path,
+                                              PostProcessingStats* stats) const {
+    PostProcessingStats local;
+    local.inputPoints = path.size();
+    std::vector<Point> result = path;
+    if (path.size() >= 3 && options.shortcut) {
+        result = shortcutPath(map, path, local);
+    }
+    local.shortcutPoints = result.size();
+    if (result.size() >= 2 && options.smoothing && options.sampleSpacing > 0.0) {
+        result = smoothPath(map, result, local);
+    }
+    local.outputPoints = result.size();
+    if (stats) {
+        *stats = local;
+    }
+    return result;
+}
+
+void PathPostProcessor::apply(const Map& map, PathPlanningResult& result) const {
+    if (!result.success || result.path.size() < 2) {
+        return;
+    }
+    auto begin = std::chrono::steady_clock::now();
+    PostProcessingStats stats;
+    result.path = process(map, result.path, &stats);
+    result.pathLength = 0.0;
+    for (size_t i = 1; i < result.path.size(); i++) {
+        result.pathLength += result.path[i-1].distanceTo(result.path[i]);
+    }
+    result.stats.postProcessNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - begin).count();
+    result.stats.postProcessRemovedPoints = stats.inputPoints - stats.shortcutPoints;
+}
+
+// 贪心视线捷径：锚点能直接看到第 k 点时跳过第 k-1 点，否则保留第 k-1 点作为新锚点
+std::vector<Point> PathPostProcessor::shortcutPath(const Map& map, const std::vector<Point>& path,
+                                                   PostProcessingStats& stats) const {
+    std::vector<Point> result;
+    result.push_back(path.front());
+    size_t anchor = 0;
+    for (size_t k = 2; k < path.size(); k++) {
+        stats.segmentChecks++;
+        if (map.isLineColliding(path[anchor], path[k], stats.cellsTraversed)) {
+            result.push_back(path[k - 1]);
+            anchor = k - 1;
+        }
+    }
+    result.push_back(path.back());
+    return result;
+}
+
+// 逐段 Hermite 样条平滑；各航点处两侧共用切线方向，保证切线方向连续
+std::vector<Point> PathPostProcessor::smoothPath(const Map& map, const std::vector<Point>& waypoints,
+                                                 PostProcessingStats& stats) const {
+    const size_t count = waypoints.size();
+    std::vector<Point> tangents(count);
+    for (size_t i = 0; i < count; i++) {
+        const Point& before = waypoints[i == 0 ? 0 : i - 1];
+        const Point& after = waypoints[i + 1 == count ? count - 1 : i + 1];
+        tangents[i] = direction(before, after);
+    }
+
+    const double spacing = options.sampleSpacing;
+    static const double TANGENT_SCALES[] = {1.0, 0.5, 0.25, 0.0};
+    std::vector<Point> result;
+    result.push_back(waypoints.front());
+    std::vector<Point> dense;
+    std::vector<double> arc;
+    std::vector<Point> samples;
+
+    for (size_t i = 0; i + 1 < count; i++) {
+        const Point& p0 = waypoints[i];
+        const Point& p1 = waypoints[i + 1];
+        double chord = p0.distanceTo(p1);
+        if (chord < Constants::EPSILON) {
+            continue;
+        }
+        int denseCount = std::max(8, static_cast<int>(std::ceil(chord / spacing)) * 4);
+
+        for (double scale : TANGENT_SCALES) {
+            HermiteSpan span{p0, scaled(tangents[i], chord * scale), p1, scaled(tangents[i + 1], chord * scale)};
+
+            // 稠密采样求弧长，同时检查曲率
+            bool curvatureOk = true;
+            dense.clear();
+            arc.clear();
+            dense.push_back(p0);
+            arc.push_back(0.0);
+            for (int s = 1; s <= denseCount; s++) {
+                double t = static_cast<double>(s) / denseCount;
+                dense.push_back(s == denseCount ? p1 : span.at(t));
+                arc.push_back(arc.back() + dense[s - 1].distanceTo(dense[s]));
+                if (scale > 0.0 && options.maxCurvature > 0.0 && span.curvature(t) > options.maxCurvature) {
+                    curvatureOk = false;
+                }
+            }
+            if (!curvatureOk) {
+                continue;
+            }
+
+            // 按固定弧长重采样（每段等分，间距不超过 sampleSpacing）
+            int sampleCount = std::max(1, static_cast<int>(std::ceil(arc.back() / spacing)));
+            samples.clear();
+            size_t segment = 1;
+            for (int s = 1; s < sampleCount; s++) {
+                double target = arc.back() * s / sampleCount;
+                while (segment + 1 < arc.size() && arc[segment] < target) {
+                    segment++;
+                }
+                double length = arc[segment] - arc[segment - 1];
+                double t = length > 0.0 ? (target - arc[segment - 1]) / length : 0.0;
+                samples.push_back(dense[segment - 1] + scaled(dense[segment] - dense[segment - 1], t));
+            }
+            samples.push_back(p1);
+
+            // 直线段即捷径线段本身，已做过碰撞检测
+            bool collisionFree = true;
+            if (scale > 0.0) {
+                Point previous = p0;
+                for (const Point& sample : samples) {
+                    stats.segmentChecks++;
+                    if (map.isLineColliding(previous, sample, stats.cellsTraversed)) {
+                        collisionFree = false;
+                        break;
+                    }
+                    previous = sample;
+                }
+            }
+            if (!collisionFree) {
+                continue;
+            }
+
+            if (scale < 1.0) {
+                stats.relaxedSpans++;
+            }
+            if (scale == 0.0) {
+                stats.straightSpans++;
+            }
+            result.insert(result.end(), samples.begin(), samples.end());
+            break;  // 切线缩放为 0 时必然接受
+        }
+    }
+    return result;
+}
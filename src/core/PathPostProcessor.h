@@ -0,0 +1,75 @@
+#ifndef PATH_POST_PROCESSOR_H
+#define PATH_POST_PROCESSOR_H
+
+#include "../../include/Common.h"
+#include "../../include/algorithm/IPathPlanningAlgorithm.h"
+#include "Map.h"
+#include <cstdint>
+#include <vector>
+
+// 路径后处理选项
+struct PostProcessingOptions {
+    bool shortcut = true;          // 贪心视线捷径：删除可直接连通的中间航点
+    bool smoothing = false;        // 样条平滑：航点间逐段三次 Hermite 曲线（单位切线取相邻航点连线方向、乘以段长），
+                                   // 碰撞或曲率超限时切线依次缩放为 1、0.5、0.25、0 倍；按固定弧长采样
+    double sampleSpacing = 0.25;   // 样条采样的弧长间距
+    double maxCurvature = 2.0;     // 样条曲率上限（转弯半径的倒数），<=0 为不限制
+};
+
+// 单次后处理统计
+struct PostProcessingStats {
+    size_t inputPoints = 0;        // 输入路径点数
+    size_t shortcutPoints = 0;     // 捷径后的航点数
+    size_t outputPoints = 0;       // 输出路径点数
+    int relaxedSpans = 0;          // 因碰撞或曲率超限而收紧切线的样条段数
+    int straightSpans = 0;         // 最终退化为直线段的样条段数
+    uint64_t segmentChecks = 0;    // 线段碰撞检测次数
+    uint64_t cellsTraversed = 0;   // 碰撞检测遍历的网格数
+};
+
+/**
+ * @brief 路径后处理器：贪心视线捷径 + 曲率受限的样条平滑
+ *
+ * 捷径沿路径单遍前进，只有锚点到下一点的视线被遮挡时才保留前一点，线段检测次数与点数成线性；
+ * 平滑在捷径后的航点间逐段生成 Hermite 样条（切线方向取相邻航点连线方向，长度与段长成比例），
+ * 采样点之间的线段碰撞或曲率超过上限时逐步缩短该段切线，最终退化为原直线段，
+ * 因此输出路径始终无碰撞（输入路径本身无碰撞时）。总耗时与路径长度成线性。
+ * 不保存状态，process 可在多个线程上并发调用。
+ */
+class PathPostProcessor {
+private:
+    PostProcessingOptions options;
+
+    // 贪心视线捷径
+    std::vector<Point> shortcutPath(const Map& map, const std::vector<Point>& path,
+                                    PostProcessingStats& stats) const;
+
+    // 逐段样条平滑并按弧长采样
+    std::vector<Point> smoothPath(const Map& map, const std::vector<Point>& waypoints,
+                                  PostProcessingStats& stats) const;
+
+public:
+    explicit PathPostProcessor(const PostProcessingOptions& opts = PostProcessingOptions());
+
+    void setOptions(const PostProcessingOptions& opts);
+    const PostProcessingOptions& getOptions() const;
+
+    /**
+     * @brief 对路径做后处理（首末点保持不变）
+     * @param map 地图
+     * @param path 输入路径
+     * @param stats 输出统计（可为空）
+     * @return std::vector<Point> 处理后的路径
+     */
+    std::vector<Point> process(const Map& map, const std::vector<Point>& path,
+                               PostProcessingStats* stats = nullptr) const;
+
+    /**
+     * @brief 对成功的规划结果做后处理：替换路径并重新计算长度，记录耗时与捷径删除的点数
+     *
+     * PathPlanner 与规划服务共用；失败或少于两个点的结果保持不变。
+     */
+    void apply(const Map& map, PathPlanningResult& result) const;
+};
+
+#endif // PATH_POST_PROCESSOR_H
@@ -0,0 +1,772 @@
+#include "PlanningServer.h"
+#include "Logger.h"
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <istream>
+#include <ostream>
+
+#ifndef _WIN32
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// 最小 JSON 读取器：只支持协议用到的对象、数组、字符串、数字与字面量
+class JsonCursor {
+private:
+    const std::string& text;
+    size_t pos;
+
+public:
+    explicit JsonCursor(const std::string& t) : text(t), pos(0) {}
+
+    void skipSpace() {
+        while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\r' || text[pos] == '\n')) {
+            pos++;
+        }
+    }
+
+    bool atEnd() {
+        skipSpace();
+        return pos >= text.size();
+    }
+
+    bool consume(char c) {
+        skipSpace();
+        if (pos < text.size() && text[pos] == c) {
+            pos++;
+            return true;
+        }
+        return false;
+    }
+
+    char peek() {
+        skipSpace();
+        return pos < text.size() ? text[pos] : '\0';
+    }
+
+    bool readString(std::string& value) {
+        value.clear();
+        if (!consume('"')) {
+            return false;
+        }
+        while (pos < text.size()) {
+            char c = text[pos++];
+            if (c == '"') {
+                return true;
+            }
+            if (c != '\\') {
+                value.push_back(c);
+                continue;
+            }
+            if (pos >= text.size()) {
+                return false;
+            }
+            char escaped = text[pos++];
+            switch (escaped) {
+                case 'n': value.push_back('\n'); break;
+                case 't': value.push_back('\t'); break;
+                case 'r': value.push_back('\r'); break;
+                case 'b': value.push_back('\b'); break;
+                case 'f': value.push_back('\f'); break;
+                case 'u':
+                    // 协议中的字符串只用于 id、op 与错误信息，\uXXXX 原样保留
+                    value.append("\\u");
+                    break;
+                default: value.push_back(escaped); break;
+            }
+        }
+        return false;
+    }
+
+    // 只接受 JSON 数字语法 -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?，
+    // strtod 额外接受的 nan、inf、十六进制与溢出为无穷大的值都视为不合法
+    bool readNumber(double& value) {
+        skipSpace();
+        size_t end = pos;
+        auto digits = [&] {
+            size_t begin = end;
+            while (end < text.size() && text[end] >= '0' && text[end] <= '9') {
+                end++;
+            }
+            return end > begin;
+        };
+        if (end < text.size() && text[end] == '-') {
+            end++;
+        }
+        if (end < text.size() && text[end] == '0') {
+            end++;
+        } else if (!digits()) {
+            return false;
+        }
+        if (end < text.size() && text[end] == '.') {
+            end++;
+            if (!digits()) {
+                return false;
+            }
+        }
+        if (end < text.size() && (text[end] == 'e' || text[end] == 'E')) {
+            end++;
+            if (end < text.size() && (text[end] == '+' || text[end] == '-')) {
+                end++;
+            }
+            if (!digits()) {
+                return false;
+            }
+        }
+        value = std::strtod(text.substr(pos, end - pos).c_str(), nullptr);
+        if (!std::isfinite(value)) {
+            return false;
+        }
+        pos = end;
+        return true;
+    }
+
+    // 取值为非负整数的数字；纯数字写法按 64 位无符号整数精确解析，其余写法（如 1e3）须为 [0, 2^64) 内的整数
+    bool readUnsigned(uint64_t& value) {
+        skipSpace();
+        size_t begin = pos;
+        double number;
+        if (!readNumber(number)) {
+            return false;
+        }
+        std::string token = text.substr(begin, pos - begin);
+        if (token.find_first_not_of("0123456789") == std::string::npos) {
+            errno = 0;
+            value = std::strtoull(token.c_str(), nullptr, 10);
+            return errno != ERANGE;
+        }
+        if (!(number >= 0.0 && number < 18446744073709551616.0) || number != std::floor(number)) {
+            return false;
+        }
+        value = static_cast<uint64_t>(number);
+        return true;
+    }
+
+    bool readLiteral(const char* literal) {
+        skipSpace();
+        size_t length = std::strlen(literal);
+        if (text.compare(pos, length, literal) != 0) {
+            return false;
+        }
+        pos += length;
+        return true;
+    }
+
+    bool readBool(bool& value) {
+        if (readLiteral("true")) {
+            value = true;
+            return true;
+        }
+        if (readLiteral("false")) {
+            value = false;
+            return true;
+        }
+        return false;
+    }
+
+    // [x, y]
+    bool readPoint(Point& point) {
+        return consume('[') && readNumber(point.x) && consume(',') && readNumber(point.y) && consume(']');
+    }
+
+    // 数字或字符串，返回其原始文本（用于原样回显 id）
+    bool readRawScalar(std::string& raw) {
+        skipSpace();
+        size_t begin = pos;
+        std::string ignoredString;
+        double ignoredNumber;
+        if (peek() == '"' ? readString(ignoredString) : readNumber(ignoredNumber)) {
+            raw = text.substr(begin, pos - begin);
+            return true;
+        }
+        return false;
+    }
+
+    bool skipValue(int depth = 0) {
+        if (depth > 32) {
+            return false;
+        }
+        char c = peek();
+        if (c == '"') {
+            std::string ignored;
+            return readString(ignored);
+        }
+        if (c == '{' || c == '[') {
+            char close = c == '{' ? '}' : ']';
+            pos++;
+            if (consume(close)) {
+                return true;
+            }
+            do {
+                if (c == '{') {
+                    std::string key;
+                    if (!readString(key) || !consume(':')) {
+                        return false;
+                    }
+                }
+                if (!skipValue(depth + 1)) {
+                    return false;
+                }
+            } while (consume(','));
+            return consume(close);
+        }
+        bool ignoredBool;
+        double ignoredNumber;
+        return readBool(ignoredBool) || readLiteral("null") || readNumber(ignoredNumber);
+    }
+
+    /**
+     * @brief 遍历对象的各个键，由 onKey 读取值；onKey 返回 false 表示值不合法
+     */
+    template <typename OnKey>
+    bool readObject(OnKey&& onKey, std::string& error) {
+        if (!consume('{')) {
+            error = "expected a JSON object";
+            return false;
+        }
+        if (consume('}')) {
+            return true;
+        }
+        do {
+            std::string key;
+            if (!readString(key) || !consume(':')) {
+                error = "malformed key";
+                return false;
+            }
+            if (!onKey(key)) {
+                if (error.empty()) {
+                    error = "invalid value for \"" + key + "\"";
+                }
+                return false;
+            }
+        } while (consume(','));
+        if (!consume('}') || !atEnd()) {
+            error = "malformed object";
+            return false;
+        }
+        return true;
+    }
+};
+
+void appendNumber(std::string& out, double value) {
+    char buffer[32];
+    int length = std::snprintf(buffer, sizeof(buffer), "%.10g", value);
+    out.append(buffer, static_cast<size_t>(length));
+}
+
+void appendEscaped(std::string& out, const std::string& value) {
+    out.push_back('"');
+    for (char c : value) {
+        if (c == '"' || c == '\\') {
+            out.push_back('\\');
+            out.push_back(c);
+        } else if (c == '\n') {
+            out.append("\\n");
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            out.push_back(' ');
+        } else {
+            out.push_back(c);
+        }
+    }
+    out.push_back('"');
+}
+
+void appendPoint(std::string& out, const Point& point) {
+    out.push_back('[');
+    appendNumber(out, point.x);
+    out.push_back(',');
+    appendNumber(out, point.y);
+    out.push_back(']');
+}
+
+double millisecondsSince(std::chrono::steady_clock::time_point begin, std::chrono::steady_clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - begin).count();
+}
+
+} // namespace
+
+namespace PlanningProtocol {
+
+bool parseRequest(const std::string& line, Request& request, std::string& error) {
+    request = Request();
+    error.clear();
+    JsonCursor cursor(line);
+    bool ok = cursor.readObject([&](const std::string& key) {
+        double number = 0.0;
+        if (key == "id") {
+            if (!cursor.readRawScalar(request.id)) {
+                error = "id must be a number or a string";
+                return false;
+            }
+            return true;
+        } else if (key == "op") {
+            std::string op;
+            if (!cursor.readString(op) || (op != "plan" && op != "ping")) {
+                error = "unknown op";
+                return false;
+            }
+            request.ping = op == "ping";
+            return true;
+        } else if (key == "start") {
+            return request.hasStart = cursor.readPoint(request.start);
+        } else if (key == "goal") {
+            return request.hasGoal = cursor.readPoint(request.goal);
+        } else if (key == "waypoints") {
+            // 先检查范围再转换为 int，负数、小数与超出 int 范围的值都不会被截断成合法值
+            if (!cursor.readNumber(number) || number != std::floor(number) || number < 1 || number > 64) {
+                error = "waypoints must be an integer between 1 and 64";
+                return false;
+            }
+            request.waypoints = static_cast<int>(number);
+            return true;
+        } else if (key == "seed") {
+            if (!cursor.readUnsigned(request.seed)) {
+                error = "seed must be an integer between 0 and 2^64-1";
+                return false;
+            }
+            request.hasSeed = true;
+            return true;
+        } else if (key == "maxTime") {
+            // 省略该字段才取服务端默认值；显式给出的 0、负数或过大的时限视为不合法
+            if (!cursor.readNumber(number) || number <= 0.0 || number > 3600.0) {
+                error = "maxTime must be a positive number of seconds up to 3600";
+                return false;
+            }
+            request.maxTime = number;
+            return true;
+        }
+        return cursor.skipValue();  // 未知字段忽略，便于协议扩展
+    }, error);
+    if (!ok) {
+        return false;
+    }
+    if (!request.ping && (!request.hasStart || !request.hasGoal)) {
+        error = "start and goal are required";
+        return false;
+    }
+    return true;
+}
+
+bool parseResponse(const std::string& line, Response& response) {
+    response = Response();
+    std::string error;
+    JsonCursor cursor(line);
+    return cursor.readObject([&](const std::string& key) {
+        double number = 0.0;
+        if (key == "id") {
+            return cursor.readRawScalar(response.id) || cursor.readLiteral("null");
+        } else if (key == "error") {
+            return cursor.readString(response.error);
+        } else if (key == "success") {
+            return cursor.readBool(response.success);
+        } else if (key == "fitness") {
+            return cursor.readNumber(response.fitness);
+        } else if (key == "length") {
+            return cursor.readNumber(response.length);
+        } else if (key == "iterations") {
+            bool ok = cursor.readNumber(number);
+            response.iterations = static_cast<int>(number);
+            return ok;
+        } else if (key == "reason") {
+            return cursor.readString(response.reason);
+        } else if (key == "planMs") {
+            return cursor.readNumber(response.planMs);
+        } else if (key == "queueMs") {
+            return cursor.readNumber(response.queueMs);
+        } else if (key == "worker") {
+            bool ok = cursor.readNumber(number);
+            response.worker = static_cast<int>(number);
+            return ok;
+        } else if (key == "path") {
+            if (!cursor.consume('[')) {
+                return false;
+            }
+            if (cursor.consume(']')) {
+                return true;
+            }
+            do {
+                Point point;
+                if (!cursor.readPoint(point)) {
+                    return false;
+                }
+                response.path.push_back(point);
+            } while (cursor.consume(','));
+            return cursor.consume(']');
+        }
+        return cursor.skipValue();
+    }, error);
+}
+
+std::string formatRequest(const Request& request) {
+    std::string out = "{\"id\":";
+    out += request.id;
+    if (request.ping) {
+        out += ",\"op\":\"ping\"}";
+        return out;
+    }
+    out += ",\"start\":";
+    appendPoint(out, request.start);
+    out += ",\"goal\":";
+    appendPoint(out, request.goal);
+    if (request.waypoints >= 0) {
+        out += ",\"waypoints\":" + std::to_string(request.waypoints);
+    }
+    if (request.hasSeed) {
+        out += ",\"seed\":" + std::to_string(request.seed);
+    }
+    if (request.maxTime > 0.0) {
+        out += ",\"maxTime\":";
+        appendNumber(out, request.maxTime);
+    }
+    out.push_back('}');
+    return out;
+}
+
+std::string formatResult(const std::string& id, const PathPlanningResult& result, double queueMs, int worker) {
+    std::string out;
+    out.reserve(160 + result.path.size() * 24);
+    out += "{\"id\":";
+    out += id;
+    out += result.success ? ",\"success\":true" : ",\"success\":false";
+    out += ",\"fitness\":";
+    appendNumber(out, result.fitness);
+    out += ",\"length\":";
+    appendNumber(out, result.pathLength);
+    out += ",\"iterations\":" + std::to_string(result.iterations);
+    out += ",\"reason\":\"";
+    out += terminationReasonName(result.terminationReason);
+    out += "\",\"planMs\":";
+    appendNumber(out, (result.stats.totalNs + result.stats.postProcessNs) / 1e6);
+    out += ",\"queueMs\":";
+    appendNumber(out, queueMs);
+    out += ",\"worker\":" + std::to_string(worker);
+    out += ",\"path\":[";
+    for (size_t i = 0; i < result.path.size(); i++) {
+        if (i > 0) {
+            out.push_back(',');
+        }
+        appendPoint(out, result.path[i]);
+    }
+    out += "]}";
+    return out;
+}
+
+std::string formatError(const std::string& id, const std::string& message) {
+    std::string out = "{\"id\":";
+    out += id;
+    out += ",\"error\":";
+    appendEscaped(out, message);
+    out.push_back('}');
+    return out;
+}
+
+} // namespace PlanningProtocol
+
+void PlanningServer::Session::send(const std::string& line) {
+    std::lock_guard<std::mutex> lock(mutex);
+    write(line);
+}
+
+void PlanningServer::Session::waitIdle() {
+    std::unique_lock<std::mutex> lock(mutex);
+    idle.wait(lock, [&] { return pending == 0; });
+}
+
+PlanningServer::PlanningServer(Map* m, AlgorithmFactory factory, int workerCount, size_t capacity)
+    : map(m), defaultWaypoints(6), defaultSeed(1), defaultMaxTime(30.0), postProcessingEnabled(false),
+      queueCapacity(capacity > 0 ? capacity : 1), stopping(false), stopRequested(false),
+      received(0), planned(0), succeeded(0), rejected(0), planNs(0) {
+    if (workerCount <= 0) {
+        workerCount = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    }
+    // 实例在调用线程上一次性创建，工厂本身无需线程安全
+    for (int i = 0; i < workerCount; i++) {
+        algorithms.push_back(factory());
+    }
+    for (int i = 0; i < workerCount; i++) {
+        workers.emplace_back([this, i] { workerLoop(i); });
+    }
+}
+
+PlanningServer::~PlanningServer() {
+    {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        stopping = true;
+    }
+    jobAvailable.notify_all();
+    slotAvailable.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void PlanningServer::setDefaults(int waypoints, uint64_t seed, double maxTime) {
+    defaultWaypoints = waypoints;
+    defaultSeed = seed;
+    defaultMaxTime = maxTime;
+}
+
+void PlanningServer::setPostProcessing(bool enabled, const PostProcessingOptions& options) {
+    postProcessingEnabled = enabled;
+    postProcessor.setOptions(options);
+}
+
+int PlanningServer::getWorkerCount() const {
+    return static_cast<int>(workers.size());
+}
+
+PlanningServerStats PlanningServer::getStats() const {
+    PlanningServerStats stats;
+    stats.received = received.load(std::memory_order_relaxed);
+    stats.planned = planned.load(std::memory_order_relaxed);
+    stats.succeeded = succeeded.load(std::memory_order_relaxed);
+    stats.rejected = rejected.load(std::memory_order_relaxed);
+    stats.planNs = planNs.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void PlanningServer::submit(const std::string& line, const std::shared_ptr<Session>& session) {
+    if (line.find_first_not_of(" \t\r") == std::string::npos) {
+        return;  // 忽略空行
+    }
+    received.fetch_add(1, std::memory_order_relaxed);
+
+    Job job;
+    std::string error;
+    if (!PlanningProtocol::parseRequest(line, job.request, error)) {
+        rejected.fetch_add(1, std::memory_order_relaxed);
+        session->send(PlanningProtocol::formatError(job.request.id, error));
+        return;
+    }
+    const PlanningProtocol::Request& request = job.request;
+    if (request.ping) {
+        session->send("{\"id\":" + request.id + ",\"pong\":true}");
+        return;
+    }
+    if (!map->isInBounds(request.start.x, request.start.y) || !map->isInBounds(request.goal.x, request.goal.y)) {
+        error = "start or goal outside the map";
+    }
+    if (!error.empty()) {
+        rejected.fetch_add(1, std::memory_order_relaxed);
+        session->send(PlanningProtocol::formatError(request.id, error));
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(session->mutex);
+        session->pending++;
+    }
+    job.session = session;
+    job.enqueued = std::chrono::steady_clock::now();
+    {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        slotAvailable.wait(lock, [&] { return stopping || queue.size() < queueCapacity; });
+        queue.push_back(std::move(job));
+    }
+    jobAvailable.notify_one();
+}
+
+void PlanningServer::workerLoop(int worker) {
+    for (;;) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(queueMutex);
+            jobAvailable.wait(lock, [&] { return stopping || !queue.empty(); });
+            if (queue.empty()) {
+                return;  // 停止时先处理完已排队的请求
+            }
+            job = std::move(queue.front());
+            queue.pop_front();
+        }
+        slotAvailable.notify_one();
+        execute(job, worker);
+    }
+}
+
+void PlanningServer::execute(Job& job, int worker) {
+    const PlanningProtocol::Request& request = job.request;
+    PathPlanningRequest planRequest;
+    planRequest.startPoint = request.start;
+    planRequest.endPoint = request.goal;
+    planRequest.map = map;
+    planRequest.numWaypoints = request.waypoints > 0 ? request.waypoints : defaultWaypoints;
+    planRequest.maxTime = request.maxTime > 0.0 ? request.maxTime : defaultMaxTime;
+    planRequest.randomSeed = request.hasSeed ? request.seed : defaultSeed;
+
+    auto begin = std::chrono::steady_clock::now();
+    PathPlanningResult result = algorithms[worker]->planPath(planRequest);
+    if (postProcessingEnabled) {
+        postProcessor.apply(*map, result);
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    planned.fetch_add(1, std::memory_order_relaxed);
+    if (result.success) {
+        succeeded.fetch_add(1, std::memory_order_relaxed);
+    }
+    planNs.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count(),
+                     std::memory_order_relaxed);
+
+    std::string response = PlanningProtocol::formatResult(request.id, result, millisecondsSince(job.enqueued, begin),
+                                                          worker);
+    Session& session = *job.session;
+    std::lock_guard<std::mutex> lock(session.mutex);
+    session.write(response);
+    if (--session.pending == 0) {
+        session.idle.notify_all();
+    }
+}
+
+uint64_t PlanningServer::serveStream(std::istream& in, std::ostream& out) {
+    auto session = std::make_shared<Session>();
+    session->write = [&out](const std::string& line) {
+        out << line << '\n';
+        out.flush();
+    };
+    uint64_t lines = 0;
+    std::string line;
+    while (std::getline(in, line)) {
+        lines++;
+        submit(line, session);
+    }
+    session->waitIdle();
+    return lines;
+}
+
+void PlanningServer::stop() {
+    stopRequested.store(true, std::memory_order_relaxed);
+#ifndef _WIN32
+    std::lock_guard<std::mutex> lock(connectionMutex);
+    for (int fd : connectionFds) {
+        ::shutdown(fd, SHUT_RD);
+    }
+#endif
+}
+
+#ifndef _WIN32
+
+void PlanningServer::serveConnection(int fd) {
+    serveSession(fd);
+
+    std::lock_guard<std::mutex> lock(connectionMutex);
+    connectionFds.erase(std::find(connectionFds.begin(), connectionFds.end(), fd));
+    ::close(fd);
+    connectionsDone.notify_all();
+}
+
+void PlanningServer::serveSession(int fd) {
+    auto session = std::make_shared<Session>();
+    session->write = [fd](const std::string& line) {
+        std::string data = line;
+        data.push_back('\n');
+        size_t sent = 0;
+        while (sent < data.size()) {
+#ifdef MSG_NOSIGNAL
+            ssize_t n = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+#else
+            ssize_t n = ::send(fd, data.data() + sent, data.size() - sent, 0);
+#endif
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                return;  // 客户端已断开，丢弃剩余响应
+            }
+            sent += static_cast<size_t>(n);
+        }
+    };
+
+    char buffer[8192];
+    std::string pending;
+    for (;;) {
+        ssize_t n = ::read(fd, buffer, sizeof(buffer));
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            break;
+        }
+        pending.append(buffer, static_cast<size_t>(n));
+        size_t begin = 0;
+        size_t newline;
+        while ((newline = pending.find('\n', begin)) != std::string::npos) {
+            submit(pending.substr(begin, newline - begin), session);
+            begin = newline + 1;
+        }
+        pending.erase(0, begin);
+    }
+    if (!pending.empty()) {
+        submit(pending, session);
+    }
+    session->waitIdle();
+}
+
+bool PlanningServer::serveUnixSocket(const std::string& path) {
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        LOG_ERROR("套接字路径过长: " << path);
+        return false;
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+
+    int listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        LOG_ERROR("无法创建套接字: " << std::strerror(errno));
+        return false;
+    }
+    ::unlink(path.c_str());
+    if (::bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listenFd, 64) != 0) {
+        LOG_ERROR("无法监听 " << path << ": " << std::strerror(errno));
+        ::close(listenFd);
+        return false;
+    }
+    LOG_INFO("规划服务监听 " << path << "，工作线程 " << workers.size() << " 个");
+
+    while (!stopRequested.load(std::memory_order_relaxed)) {
+        // 定时醒来检查停止标志
+        pollfd listenPoll{listenFd, POLLIN, 0};
+        int ready = ::poll(&listenPoll, 1, 100);
+        if (ready <= 0) {
+            continue;
+        }
+        int fd = ::accept(listenFd, nullptr, nullptr);
+        if (fd < 0) {
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> lock(connectionMutex);
+            connectionFds.push_back(fd);
+        }
+        std::thread([this, fd] { serveConnection(fd); }).detach();
+    }
+
+    ::close(listenFd);
+    ::unlink(path.c_str());
+    // stop() 之后才建立的连接同样关闭读端，再等待所有连接回复完毕
+    std::unique_lock<std::mutex> lock(connectionMutex);
+    for (int fd : connectionFds) {
+        ::shutdown(fd, SHUT_RD);
+    }
+    connectionsDone.wait(lock, [&] { return connectionFds.empty(); });
+    return true;
+}
+
+#else
+
+bool PlanningServer::serveUnixSocket(const std::string& path) {
+    LOG_ERROR("当前平台不支持 Unix 域套接字，请使用标准输入输出模式: " << path);
+    return false;
+}
+
+#endif
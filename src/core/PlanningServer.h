@@ -0,0 +1,214 @@
+#ifndef PLANNING_SERVER_H
+#define PLANNING_SERVER_H
+
+#include "../../include/Common.h"
+#include "../../include/algorithm/IPathPlanningAlgorithm.h"
+#include "Map.h"
+#include "PathPostProcessor.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iosfwd>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * 规划服务协议：每行一个 JSON 对象（行分隔 JSON），请求与响应以 id 对应。
+ *
+ * 请求:  {"id":7,"start":[2,2],"goal":[17,17],"waypoints":6,"seed":1,"maxTime":5}
+ *        start/goal 必填；waypoints/seed/maxTime 可省略（取服务端默认值）；
+ *        waypoints 须为 1~64 的整数，seed 须为 [0, 2^64) 内的整数，maxTime 须为 (0, 3600] 秒；
+ *        数字只接受标准 JSON 写法
+ *        （nan、inf、十六进制等一律视为格式错误）；
+ *        {"id":8,"op":"ping"} 用于探活，不进入规划队列。
+ * 响应:  {"id":7,"success":true,"fitness":..,"length":..,"iterations":..,"reason":"stalled",
+ *         "planMs":..,"queueMs":..,"worker":2,"path":[[x,y],...]}
+ *        请求无法解析或不合法时为 {"id":7,"error":"..."}（无法解析出 id 时 id 为 null）。
+ * 同一连接上可连续发送多个请求而不等待响应（流水线），响应按完成顺序返回。
+ */
+namespace PlanningProtocol {
+
+// 解析后的规划请求
+struct Request {
+    std::string id = "null";   // 原样回显的 id（JSON 数字或带引号的字符串）
+    bool ping = false;
+    bool hasStart = false;
+    bool hasGoal = false;
+    Point start;
+    Point goal;
+    int waypoints = -1;        // -1 为服务端默认值，解析出的值总在 1~64 之间
+    bool hasSeed = false;
+    uint64_t seed = 0;
+    double maxTime = 0.0;      // 0 为服务端默认值，解析出的值总在 (0, 3600] 之间
+};
+
+// 解析后的响应（客户端与测试使用）
+struct Response {
+    std::string id = "null";
+    std::string error;         // 非空表示请求被拒绝
+    bool success = false;
+    double fitness = 0.0;
+    double length = 0.0;
+    int iterations = 0;
+    std::string reason;
+    double planMs = 0.0;
+    double queueMs = 0.0;
+    int worker = -1;
+    std::vector<Point> path;
+};
+
+/**
+ * @brief 解析一行请求
+ * @param error 失败时的原因（已解析出的 id 仍保留在 request 中）
+ */
+bool parseRequest(const std::string& line, Request& request, std::string& error);
+
+// 解析一行响应
+bool parseResponse(const std::string& line, Response& response);
+
+// 格式化请求（客户端与负载生成工具使用）
+std::string formatRequest(const Request& request);
+
+// 格式化规划结果
+std::string formatResult(const std::string& id, const PathPlanningResult& result,
+                         double queueMs, int worker);
+
+// 格式化错误响应
+std::string formatError(const std::string& id, const std::string& message);
+
+} // namespace PlanningProtocol
+
+// 服务运行统计
+struct PlanningServerStats {
+    uint64_t received = 0;      // 收到的请求行数
+    uint64_t planned = 0;       // 完成的规划数
+    uint64_t succeeded = 0;     // 成功的规划数
+    uint64_t rejected = 0;      // 被拒绝的请求数（解析失败或不合法）
+    int64_t planNs = 0;         // 规划总耗时（纳秒，各工作线程累加）
+};
+
+/**
+ * @brief 常驻规划服务
+ *
+ * 地图与配置只在启动时加载一次；每个工作线程独占一个算法实例（由工厂创建），
+ * 实例内部按次复用的规划上下文（粒子群缓冲区、碰撞缓存等）在请求之间保持，
+ * 避免每次规划都重新启动进程、解析配置与地图。
+ * 读取线程只负责解析请求并放入有界队列，工作线程按完成顺序写回响应；
+ * 队列满时读取线程阻塞，由此对发送过快的客户端施加反压。
+ * 地图在服务运行期间只读，多个工作线程并发访问是安全的。
+ */
+class PlanningServer {
+public:
+    using AlgorithmFactory = std::function<std::unique_ptr<IPathPlanningAlgorithm>()>;
+
+private:
+    // 一个请求来源（标准输入或一个套接字连接）：串行化写出，并记录尚未完成的请求数
+    struct Session {
+        std::function<void(const std::string&)> write;
+        std::mutex mutex;
+        std::condition_variable idle;
+        int pending = 0;
+
+        void send(const std::string& line);
+        void waitIdle();
+    };
+
+    struct Job {
+        PlanningProtocol::Request request;
+        std::shared_ptr<Session> session;
+        std::chrono::steady_clock::time_point enqueued;
+    };
+
+    Map* map;
+    int defaultWaypoints;
+    uint64_t defaultSeed;
+    double defaultMaxTime;
+    bool postProcessingEnabled;
+    PathPostProcessor postProcessor;
+
+    std::vector<std::unique_ptr<IPathPlanningAlgorithm>> algorithms;
+    std::vector<std::thread> workers;
+    std::deque<Job> queue;
+    size_t queueCapacity;
+    std::mutex queueMutex;
+    std::condition_variable jobAvailable;
+    std::condition_variable slotAvailable;
+    bool stopping;
+
+    std::atomic<bool> stopRequested;
+    std::atomic<uint64_t> received;
+    std::atomic<uint64_t> planned;
+    std::atomic<uint64_t> succeeded;
+    std::atomic<uint64_t> rejected;
+    std::atomic<int64_t> planNs;
+
+    // 活动的套接字连接（stop 时关闭其读端，使读取线程结束）
+    std::mutex connectionMutex;
+    std::condition_variable connectionsDone;
+    std::vector<int> connectionFds;
+
+    void workerLoop(int worker);
+    void execute(Job& job, int worker);
+
+    // 处理一行请求：解析失败或探活请求直接回复，规划请求放入队列（队列满时阻塞）
+    void submit(const std::string& line, const std::shared_ptr<Session>& session);
+
+#ifndef _WIN32
+    // 连接线程入口：服务一个套接字连接，结束后关闭套接字
+    void serveConnection(int fd);
+
+    // 读取连接上的请求，直到对端关闭写端（或 stop）且已提交的请求全部回复
+    void serveSession(int fd);
+#endif
+
+public:
+    /**
+     * @brief 构造函数：创建工作线程与各自的算法实例
+     * @param m 地图（服务运行期间须保持有效且不被修改）
+     * @param factory 算法工厂（只在调用线程上调用）
+     * @param workerCount 工作线程数，<=0 时取硬件并发数
+     * @param capacity 待处理请求队列容量
+     */
+    PlanningServer(Map* m, AlgorithmFactory factory, int workerCount = 0, size_t capacity = 1024);
+    ~PlanningServer();
+
+    PlanningServer(const PlanningServer&) = delete;
+    PlanningServer& operator=(const PlanningServer&) = delete;
+
+    // 请求省略对应字段时使用的默认值
+    void setDefaults(int waypoints, uint64_t seed, double maxTime = 30.0);
+
+    // 设置路径后处理（与 PathPlanner 相同，适应度仍为算法给出的值）
+    void setPostProcessing(bool enabled, const PostProcessingOptions& options = PostProcessingOptions());
+
+    int getWorkerCount() const;
+    PlanningServerStats getStats() const;
+
+    /**
+     * @brief 从输入流逐行读取请求，响应写入输出流（每行写出后刷新）
+     *
+     * 输入结束后等待已提交的请求全部回复再返回。
+     * @return 读取的请求行数
+     */
+    uint64_t serveStream(std::istream& in, std::ostream& out);
+
+    /**
+     * @brief 在 Unix 域套接字上监听，每个连接一个读取线程，共享工作线程
+     *
+     * 阻塞直到 stop() 被调用；返回前等待所有连接结束。Windows 下不可用，直接返回 false。
+     * @param path 套接字路径（已存在时先删除）
+     * @return 监听是否成功建立
+     */
+    bool serveUnixSocket(const std::string& path);
+
+    // 请求 serveUnixSocket 停止接受新连接（可在任意线程调用）
+    void stop();
+};
+
+#endif // PLANNING_SERVER_H
@@ -0,0 +1,166 @@
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief 常驻线程池（fork-join 风格）
+ *
+ * 线程在构造时创建并一直复用，parallelFor 只负责唤醒与等待，
+ * 任务以函数指针 + 上下文指针的形式传递，调度过程不产生堆分配。
+ * 调用线程本身也参与执行任务，因此 threadCount 为参与计算的总线程数。
+ * 同一时刻只运行一个并行区：线程池正被其他线程的并行区占用时，
+ * 新的并行区直接在调用线程上串行执行，而不是排队等待。
+ */
+class ThreadPool {
+private:
+    std::vector<std::thread> workers;
+    std::mutex submitMutex;                 // 同一时刻只允许一个并行区
+    std::mutex stateMutex;
+    std::condition_variable wakeCondition;
+    std::condition_variable doneCondition;
+
+    void* taskContext;                      // 当前任务上下文
+    void (*taskInvoke)(void*, int, int);    // 当前任务入口（任务下标、线程编号）
+    int taskCount;
+    std::atomic<int> nextIndex;
+    int activeWorkers;
+    uint64_t generation;
+    bool stopping;
+
+    /**
+     * @brief 领取并执行任务，直到所有下标都被领取
+     * @param worker 执行线程编号（调用线程为0）
+     */
+    void runTasks(int worker) {
+        for (;;) {
+            int index = nextIndex.fetch_add(1, std::memory_order_relaxed);
+            if (index >= taskCount) {
+                break;
+            }
+            taskInvoke(taskContext, index, worker);
+        }
+    }
+
+    /**
+     * @brief 工作线程主循环
+     */
+    void workerLoop(int worker) {
+        uint64_t seenGeneration = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> lock(stateMutex);
+                wakeCondition.wait(lock, [&] { return stopping || generation != seenGeneration; });
+                if (stopping) {
+                    return;
+                }
+                seenGeneration = generation;
+            }
+            runTasks(worker);
+            {
+                std::lock_guard<std::mutex> lock(stateMutex);
+                if (--activeWorkers == 0) {
+                    doneCondition.notify_one();
+                }
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief 构造函数
+     * @param threadCount 参与计算的总线程数（含调用线程），<=0 时取硬件并发数
+     */
+    explicit ThreadPool(int threadCount)
+        : taskContext(nullptr), taskInvoke(nullptr), taskCount(0), nextIndex(0),
+          activeWorkers(0), generation(0), stopping(false) {
+        if (threadCount <= 0) {
+            threadCount = static_cast<int>(std::thread::hardware_concurrency());
+        }
+        for (int i = 1; i < threadCount; i++) {
+            workers.emplace_back([this, i] { workerLoop(i); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            stopping = true;
+        }
+        wakeCondition.notify_all();
+        for (auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * @brief 获取参与计算的总线程数
+     */
+    int getThreadCount() const {
+        return static_cast<int>(workers.size()) + 1;
+    }
+
+    /**
+     * @brief 并行执行 func(0) ... func(count-1)，返回时全部完成
+     * @param count 任务个数
+     * @param func 任务函数，签名为 void(int index)，须可被多个线程同时调用
+     */
+    template <typename Func>
+    void parallelFor(int count, Func&& func) {
+        parallelForWorker(count, [&func](int index, int) { func(index); });
+    }
+
+    /**
+     * @brief 同 parallelFor，但任务函数同时得到执行线程编号
+     *
+     * 编号范围为 [0, getThreadCount())，调用线程为0；同一编号的任务不会并发执行，
+     * 可用于索引每线程独占的资源（如各自的算法实例或缓冲区）。
+     * @param func 任务函数，签名为 void(int index, int worker)
+     */
+    template <typename Func>
+    void parallelForWorker(int count, Func&& func) {
+        using FuncType = std::remove_reference_t<Func>;
+        if (count <= 0) {
+            return;
+        }
+        std::unique_lock<std::mutex> submit(submitMutex, std::defer_lock);
+        if (workers.empty() || count == 1 || !submit.try_lock()) {
+            for (int i = 0; i < count; i++) {
+                func(i, 0);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(stateMutex);
+            taskContext = const_cast<void*>(static_cast<const void*>(&func));
+            taskInvoke = [](void* context, int index, int worker) {
+                (*static_cast<FuncType*>(context))(index, worker);
+            };
+            taskCount = count;
+            nextIndex.store(0, std::memory_order_relaxed);
+            activeWorkers = static_cast<int>(workers.size());
+            ++generation;
+        }
+        wakeCondition.notify_all();
+
+        // 调用线程同样参与计算
+        runTasks(0);
+
+        std::unique_lock<std::mutex> lock(stateMutex);
+        doneCondition.wait(lock, [&] { return activeWorkers == 0; });
+        taskContext = nullptr;
+        taskInvoke = nullptr;
+    }
+};
+
+#endif // THREADPOOL_H
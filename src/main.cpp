@@ -1,7 +1,9 @@
 // #include "algorithm/ZPSOAlgorithm.h"  // 粒子群优化算法
 #include "core/Map.h"
+#include "core/Logger.h"
 #include "core/PathPlanner.h"
 #include "algorithm/HybridAStarPSOAlgorithm.h"
+#include "algorithm/IslandPSOAlgorithm.h"
 #include "visualization/Visualizer.h"
 #include "config/ConfigManager.h"
 #include <math.h>
@@ -21,6 +23,12 @@ int main() {
     // 打印加载的配置
     configManager.printConfig();
 
+    // 规划过程日志经异步日志器输出，级别由配置决定
+    LogLevel logLevel;
+    if (Logger::parseLevel(config.logging.level, logLevel)) {
+        Logger::instance().setLevel(logLevel);
+    }
+
     // 创建地图
     Map robotMap(20, 20, config.pathPlanning.mapCellSize); // 使用配置文件中的单元格大小
     
@@ -45,28 +53,39 @@ int main() {
     }
 
     // 创建算法实例
-    auto algorithm = std::make_unique<HybridAStarPSOAlgorithm>();
-    
-    // 设置算法参数
-    algorithm->setParameter("particleCount", config.pso.particleCount);
-    algorithm->setParameter("generations", config.pso.generations);
-    algorithm->setParameter("globalGuideCoe", config.pso.globalGuideCoe);
-    algorithm->setParameter("localGuideCoe", config.pso.localGuideCoe);
-    algorithm->setParameter("maxSpeed", config.pso.maxSpeed);
+    // islandCount 大于1时使用岛屿模型多种群算法
+    std::unique_ptr<IPathPlanningAlgorithm> algorithm;
+    if (config.pso.islandCount > 1) {
+        algorithm = std::make_unique<IslandPSOAlgorithm>();
+    } else {
+        algorithm = std::make_unique<HybridAStarPSOAlgorithm>();
+    }
+    configureAlgorithm(config, *algorithm);
 
     // 创建路径规划器 - 使用配置文件中的参数
     PathPlanner planner(&robotMap, startPoint, endPoint, std::move(algorithm), config.pathPlanning.numWaypoints);
 
+    planner.setRandomSeed(config.pso.randomSeed);
+
+    // 路径后处理
+    planner.setPostProcessing(config.postProcessing.enabled != 0, postProcessingOptions(config));
+
     std::cout << "\n开始路径规划..." << std::endl;
     std::cout << "使用算法: " << planner.getCurrentAlgorithmName() << std::endl;
-    std::cout << "中间航点数量: " << config.pathPlanning.numWaypoints << std::endl;
-    std::cout << "粒子维度: " << config.pathPlanning.numWaypoints * 2 << std::endl;
+    if (config.pathPlanning.adaptiveWaypoints) {
+        std::cout << "中间航点数量: 自适应 (" << config.pathPlanning.minWaypoints << " ~ "
+                  << config.pathPlanning.maxWaypoints << ")" << std::endl;
+    } else {
+        std::cout << "中间航点数量: " << config.pathPlanning.numWaypoints << std::endl;
+        std::cout << "粒子维度: " << config.pathPlanning.numWaypoints * 2 << std::endl;
+    }
 
     // 记录开始时间
     auto startTime = std::chrono::high_resolution_clock::now();
 
     // 执行路径规划 - 使用配置文件中的PSO参数
     auto result = planner.planPath();
+    Logger::instance().flush();  // 规划日志先于结果输出
 
     // 记录结束时间
     auto endTime = std::chrono::high_resolution_clock::now();
@@ -1,13 +1,17 @@
 // #include "../src/algorithm/ZPSOAlgorithm.h"
 
 #include "core/Map.h"
+#include "core/Logger.h"
 #include "core/PathPlanner.h"
 #include "algorithm/HybridAStarPSOAlgorithm.h"
+#include "algorithm/IslandPSOAlgorithm.h"
 #include "visualization/Visualizer.h"
 #include "config/ConfigManager.h"
 #include <iostream>
+#include <fstream>
 #include <chrono>
 #include <iomanip>
+#include <cstring>
 
 using namespace std;
 
@@ -69,9 +73,35 @@ void printMap(const Map& map, const std::vector<Point>& path, const Point& start
     cout << endl;
 }
 
-int main() {
+// 将收敛记录写入文件
+static void writeTrace(const ConvergenceTrace& trace, const char* path, bool json) {
+    ofstream file(path);
+    if (!file) {
+        cout << "无法写入收敛记录文件: " << path << endl;
+        return;
+    }
+    if (json) {
+        trace.writeJson(file);
+    } else {
+        trace.writeCsv(file);
+    }
+    cout << "收敛记录已写入 " << path << " (" << trace.size() << " 代)" << endl;
+}
+
+int main(int argc, char** argv) {
     cout << "=== 基于PSO的机器人路径规划系统 (控制台版本) ===" << endl;
 
+    // 命令行参数: --trace-csv <文件> / --trace-json <文件> 导出逐代收敛记录
+    const char* traceCsvPath = nullptr;
+    const char* traceJsonPath = nullptr;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--trace-csv") == 0) {
+            traceCsvPath = argv[++i];
+        } else if (strcmp(argv[i], "--trace-json") == 0) {
+            traceJsonPath = argv[++i];
+        }
+    }
+
     // 加载配置文件
     ConfigManager configManager;
     configManager.loadConfig("data/config/pso_config.json");
@@ -79,6 +109,12 @@ int main() {
     
     configManager.printConfig();
 
+    // 规划过程日志经异步日志器输出，级别由配置决定
+    LogLevel logLevel;
+    if (Logger::parseLevel(config.logging.level, logLevel)) {
+        Logger::instance().setLevel(logLevel);
+    }
+
     // 创建地图
     Map robotMap(20, 20, config.pathPlanning.mapCellSize);
     
@@ -102,28 +138,70 @@ int main() {
     }
 
     // 创建PSO算法实例
-    auto algorithm = std::make_unique<HybridAStarPSOAlgorithm>();
-    
-    // 配置算法参数
-    algorithm->setParameter("generations", config.pso.generations);
-    algorithm->setParameter("particleCount", config.pso.particleCount);
-    algorithm->setParameter("globalGuideCoe", config.pso.globalGuideCoe);
-    algorithm->setParameter("localGuideCoe", config.pso.localGuideCoe);
-    algorithm->setParameter("maxSpeed", config.pso.maxSpeed);
+    // islandCount 大于1时使用岛屿模型多种群算法
+    std::unique_ptr<IPathPlanningAlgorithm> algorithm;
+    if (config.pso.islandCount > 1) {
+        algorithm = std::make_unique<IslandPSOAlgorithm>();
+    } else {
+        algorithm = std::make_unique<HybridAStarPSOAlgorithm>();
+    }
+    configureAlgorithm(config, *algorithm);
+    // 要求导出收敛记录而配置未开启时，容量取全部代数（含初始种群）
+    if ((traceCsvPath || traceJsonPath) && config.pso.traceCapacity <= 0) {
+        algorithm->setParameter("traceCapacity", config.pso.generations + 1);
+    }
+    // 两种算法都派生自混合算法，规划器接管所有权后仍通过该指针读取收敛记录
+    const HybridAStarPSOAlgorithm* hybridAlgorithm = static_cast<const HybridAStarPSOAlgorithm*>(algorithm.get());
 
     // 创建路径规划器
     PathPlanner planner(&robotMap, startPoint, endPoint, 
                        std::move(algorithm), config.pathPlanning.numWaypoints);
 
+    planner.setRandomSeed(config.pso.randomSeed);
+
+    // 路径后处理
+    planner.setPostProcessing(config.postProcessing.enabled != 0, postProcessingOptions(config));
+
     cout << "\n开始路径规划..." << endl;
     cout << "使用算法: " << planner.getCurrentAlgorithmName() << endl;
 
     // 执行路径规划
     auto result = planner.planPath();
+    Logger::instance().flush();  // 规划日志先于结果输出
 
     cout << "\n路径规划完成！" << endl;
     cout << "成功: " << (result.success ? "是" : "否") << endl;
     cout << "计算时间: " << result.computationTime << " 秒" << endl;
+    cout << "迭代次数: " << result.iterations << " (终止原因: "
+         << terminationReasonName(result.terminationReason) << ")" << endl;
+    uint64_t cacheLookups = result.stats.collisionCacheHits + result.stats.collisionCacheMisses;
+    if (cacheLookups > 0) {
+        cout << "碰撞缓存: 命中 " << result.stats.collisionCacheHits << " / " << cacheLookups
+             << " (" << 100.0 * result.stats.collisionCacheHits / cacheLookups << "%)" << endl;
+    }
+    if (result.stats.fitnessEvaluations > 0) {
+        cout << "惰性评估: " << result.stats.fitnessEvaluations << " 次评估, 跳过偏离与碰撞 "
+             << result.stats.evaluationsCutBeforeDeviation << " 次, 仅跳过碰撞 "
+             << result.stats.evaluationsCutBeforeCollision << " 次" << endl;
+    }
+    if (result.stats.totalNs > 0) {
+        const PlanningStats& stats = result.stats;
+        cout << "阶段耗时(ms): 引导 " << stats.guideNs / 1e6 << ", 初始化 " << stats.swarmInitNs / 1e6
+             << ", 进化 " << stats.generationsNs / 1e6 << ", 校验 " << stats.validationNs / 1e6
+             << ", 总计 " << stats.totalNs / 1e6 << endl;
+        cout << "工作量: A*扩展 " << stats.nodesExpanded << " 个节点, 线段检测 " << stats.segmentChecks
+             << " 次, 遍历网格 " << stats.cellsTraversed << " 个" << endl;
+    }
+    if (result.stats.postProcessNs > 0) {
+        cout << "路径后处理: 删除 " << result.stats.postProcessRemovedPoints << " 个路径点, 耗时 "
+             << result.stats.postProcessNs / 1e6 << " ms" << endl;
+    }
+    if (traceCsvPath) {
+        writeTrace(hybridAlgorithm->getConvergenceTrace(), traceCsvPath, false);
+    }
+    if (traceJsonPath) {
+        writeTrace(hybridAlgorithm->getConvergenceTrace(), traceJsonPath, true);
+    }
 
     if (result.success) {
         // 输出路径信息
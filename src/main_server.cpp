@@ -0,0 +1,129 @@
+#include "core/Map.h"
+#include "core/Logger.h"
+#include "core/PlanningServer.h"
+#include "algorithm/HybridAStarPSOAlgorithm.h"
+#include "algorithm/IslandPSOAlgorithm.h"
+#include "config/ConfigManager.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+// 常驻规划服务：配置与地图只加载一次，随后持续处理规划请求（协议见 core/PlanningServer.h）
+// 用法: RoboNavPlanner_Server [--config <文件>] [--map <文件>] [--workers <N>] [--socket <路径>]
+// 未指定 --socket 时从标准输入读取请求、向标准输出写出响应，此时其余输出都写到标准错误
+
+static std::atomic<bool> stopSignal(false);
+
+static void handleSignal(int) {
+    stopSignal.store(true);
+}
+
+// 按配置创建一个算法实例（参数与控制台版本一致，评估线程数取 server.planThreads）
+static std::unique_ptr<IPathPlanningAlgorithm> createAlgorithm(const AppConfig& config) {
+    std::unique_ptr<IPathPlanningAlgorithm> algorithm;
+    if (config.pso.islandCount > 1) {
+        algorithm = std::make_unique<IslandPSOAlgorithm>();
+    } else {
+        algorithm = std::make_unique<HybridAStarPSOAlgorithm>();
+    }
+    configureAlgorithm(config, *algorithm);
+    algorithm->setParameter("threadCount", config.server.planThreads);
+    return algorithm;
+}
+
+int main(int argc, char** argv) {
+    const char* configPath = "data/config/pso_config.json";
+    const char* mapPath = "data/maps/map.txt";
+    const char* socketPath = nullptr;
+    int workerOverride = -1;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--config") == 0) {
+            configPath = argv[++i];
+        } else if (strcmp(argv[i], "--map") == 0) {
+            mapPath = argv[++i];
+        } else if (strcmp(argv[i], "--socket") == 0) {
+            socketPath = argv[++i];
+        } else if (strcmp(argv[i], "--workers") == 0) {
+            workerOverride = atoi(argv[++i]);
+        }
+    }
+
+    // 标准输出留给协议：cout 与日志都改写到标准错误
+    streambuf* protocolBuffer = cout.rdbuf();
+    cout.rdbuf(cerr.rdbuf());
+    Logger::instance().setOutput(stderr);
+
+    cout << "=== 基于PSO的机器人路径规划系统 (规划服务) ===" << endl;
+
+    ConfigManager configManager;
+    configManager.loadConfig(configPath);
+    const AppConfig& config = configManager.getConfig();
+    configManager.printConfig();
+
+    LogLevel logLevel;
+    if (Logger::parseLevel(config.logging.level, logLevel)) {
+        Logger::instance().setLevel(logLevel);
+    }
+
+    Map robotMap(20, 20, config.pathPlanning.mapCellSize);
+    if (!robotMap.loadFromFile(mapPath)) {
+        cout << "无法加载地图文件，使用默认地图" << endl;
+    }
+    cout << "地图: " << robotMap.getWidth() << " x " << robotMap.getHeight() << endl;
+
+    int workers = workerOverride >= 0 ? workerOverride : config.server.workers;
+    PlanningServer server(&robotMap, [&config] { return createAlgorithm(config); }, workers,
+                          static_cast<size_t>(std::max(config.server.queueCapacity, 1)));
+    server.setDefaults(config.pathPlanning.numWaypoints, config.pso.randomSeed);
+
+    server.setPostProcessing(config.postProcessing.enabled != 0, postProcessingOptions(config));
+    cout << "工作线程: " << server.getWorkerCount() << endl;
+
+    auto begin = chrono::steady_clock::now();
+    int exitCode = 0;
+    if (socketPath) {
+#ifndef _WIN32
+        signal(SIGPIPE, SIG_IGN);
+#endif
+        signal(SIGINT, handleSignal);
+        signal(SIGTERM, handleSignal);
+        // 信号处理函数中不能加锁，由监视线程转发停止请求
+        std::atomic<bool> finished(false);
+        thread watcher([&] {
+            while (!finished.load() && !stopSignal.load()) {
+                this_thread::sleep_for(chrono::milliseconds(100));
+            }
+            server.stop();
+        });
+        cout << "监听套接字: " << socketPath << endl;
+        if (!server.serveUnixSocket(socketPath)) {
+            exitCode = 1;
+        }
+        finished.store(true);
+        watcher.join();
+    } else {
+        ostream protocolOut(protocolBuffer);
+        server.serveStream(cin, protocolOut);
+    }
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - begin).count();
+    Logger::instance().flush();
+
+    PlanningServerStats stats = server.getStats();
+    cout << "服务结束: 收到请求 " << stats.received << " 个, 规划 " << stats.planned << " 次 (成功 "
+         << stats.succeeded << "), 拒绝 " << stats.rejected << " 个, 运行 " << seconds << " 秒";
+    if (stats.planned > 0) {
+        cout << ", 平均规划耗时 " << stats.planNs / 1e6 / stats.planned << " ms";
+    }
+    cout << endl;
+
+    cout.rdbuf(protocolBuffer);
+    return exitCode;
+}
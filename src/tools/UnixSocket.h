@@ -0,0 +1,93 @@
+#ifndef UNIX_SOCKET_H
+#define UNIX_SOCKET_H
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/**
+ * 规划服务客户端工具共用的 Unix 域套接字辅助函数（仅 POSIX）
+ */
+namespace UnixSocket {
+
+// 连接到服务端套接字，失败返回 -1
+inline int connectTo(const std::string& path) {
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address.sun_path)) {
+        return -1;
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+// 写出全部数据
+inline bool writeAll(int fd, const std::string& data) {
+    size_t sent = 0;
+    while (sent < data.size()) {
+        ssize_t n = ::write(fd, data.data() + sent, data.size() - sent);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        sent += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+// 带缓冲的按行读取
+class LineReader {
+private:
+    int fd;
+    std::string buffer;
+    size_t begin = 0;
+
+public:
+    explicit LineReader(int f) : fd(f) {}
+
+    // 读取一行（不含换行符），连接关闭且没有剩余数据时返回 false
+    bool readLine(std::string& line) {
+        for (;;) {
+            size_t newline = buffer.find('\n', begin);
+            if (newline != std::string::npos) {
+                line.assign(buffer, begin, newline - begin);
+                begin = newline + 1;
+                return true;
+            }
+            buffer.erase(0, begin);
+            begin = 0;
+            char chunk[8192];
+            ssize_t n = ::read(fd, chunk, sizeof(chunk));
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                if (buffer.empty()) {
+                    return false;
+                }
+                line.swap(buffer);
+                buffer.clear();
+                return true;
+            }
+            buffer.append(chunk, static_cast<size_t>(n));
+        }
+    }
+};
+
+} // namespace UnixSocket
+
+#endif // UNIX_SOCKET_H
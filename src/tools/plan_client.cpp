@@ -0,0 +1,92 @@
+#include "../core/PlanningServer.h"
+#include "UnixSocket.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+// 规划服务的本地客户端：把请求行发送到服务端套接字，并将响应逐行打印到标准输出
+// 用法: plan_client --socket <路径> [--start x y --goal x y [--seed s] [--waypoints n] [--count k]] [--ping]
+// 未给出 --start/--goal 与 --ping 时从标准输入读取请求行（一行一个 JSON 请求），全部流水线发送
+
+int main(int argc, char** argv) {
+    const char* socketPath = nullptr;
+    PlanningProtocol::Request request;
+    int count = 1;
+    for (int i = 1; i < argc; i++) {
+        bool hasOne = i + 1 < argc;
+        bool hasTwo = i + 2 < argc;
+        if (strcmp(argv[i], "--socket") == 0 && hasOne) {
+            socketPath = argv[++i];
+        } else if (strcmp(argv[i], "--start") == 0 && hasTwo) {
+            request.start = Point(atof(argv[i + 1]), atof(argv[i + 2]));
+            request.hasStart = true;
+            i += 2;
+        } else if (strcmp(argv[i], "--goal") == 0 && hasTwo) {
+            request.goal = Point(atof(argv[i + 1]), atof(argv[i + 2]));
+            request.hasGoal = true;
+            i += 2;
+        } else if (strcmp(argv[i], "--seed") == 0 && hasOne) {
+            request.seed = strtoull(argv[++i], nullptr, 10);
+            request.hasSeed = true;
+        } else if (strcmp(argv[i], "--waypoints") == 0 && hasOne) {
+            request.waypoints = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--count") == 0 && hasOne) {
+            count = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--ping") == 0) {
+            request.ping = true;
+        }
+    }
+    if (!socketPath) {
+        cerr << "用法: plan_client --socket <路径> [--start x y --goal x y] [--seed s] [--waypoints n] "
+                "[--count k] [--ping]" << endl;
+        return 2;
+    }
+    if (!request.ping && request.hasStart != request.hasGoal) {
+        cerr << "--start 与 --goal 须同时给出" << endl;
+        return 2;
+    }
+
+    int fd = UnixSocket::connectTo(socketPath);
+    if (fd < 0) {
+        cerr << "无法连接 " << socketPath << ": " << strerror(errno) << endl;
+        return 1;
+    }
+
+    // 发送与接收分开进行，请求无需等待前一个响应
+    thread sender([&] {
+        if (request.ping || request.hasStart) {
+            for (int i = 0; i < count; i++) {
+                request.id = to_string(i + 1);
+                UnixSocket::writeAll(fd, PlanningProtocol::formatRequest(request) + "\n");
+            }
+        } else {
+            string line;
+            while (getline(cin, line)) {
+                if (!UnixSocket::writeAll(fd, line + "\n")) {
+                    break;
+                }
+            }
+        }
+        // 关闭写端：服务端回复完已发送的请求后关闭连接
+        ::shutdown(fd, SHUT_WR);
+    });
+
+    UnixSocket::LineReader reader(fd);
+    string response;
+    int failures = 0;
+    while (reader.readLine(response)) {
+        cout << response << '\n';
+        PlanningProtocol::Response parsed;
+        if (!PlanningProtocol::parseResponse(response, parsed) || !parsed.error.empty()) {
+            failures++;
+        }
+    }
+    cout.flush();
+    sender.join();
+    ::close(fd);
+    return failures == 0 ? 0 : 1;
+}
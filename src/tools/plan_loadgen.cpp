@@ -0,0 +1,193 @@
+#include "../core/Map.h"
+#include "../core/PlanningServer.h"
+#include "../algorithm/ZPSOAlgorithm.h"
+#include "UnixSocket.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+// 规划服务负载生成工具：在地图的可通行网格中随机选取起终点，
+// 以多个连接、每连接固定的在途请求数（流水线深度）向服务端发送请求，统计吞吐量与延迟分布
+// 用法: plan_loadgen --socket <路径> [--map <文件>] [--requests N] [--connections C] [--depth D] [--seed S]
+//       plan_loadgen --emit N [--map <文件>] [--seed S]   只把请求行写到标准输出，用于标准输入输出模式:
+//       plan_loadgen --emit 200 > requests.jsonl && RoboNavPlanner_Server < requests.jsonl > responses.jsonl
+
+using Clock = chrono::steady_clock;
+
+// 生成 count 个起终点互不相同的随机请求（起终点取可通行网格中心）
+static vector<PlanningProtocol::Request> generateRequests(const Map& map, int count, uint64_t seed) {
+    vector<Point> freeCells;
+    for (int y = 0; y < map.getHeight(); y++) {
+        for (int x = 0; x < map.getWidth(); x++) {
+            if (map.getCell(x, y) == 0) {
+                freeCells.emplace_back((x + 0.5) * map.getCellSize(), (y + 0.5) * map.getCellSize());
+            }
+        }
+    }
+    vector<PlanningProtocol::Request> requests;
+    if (freeCells.size() < 2) {
+        return requests;
+    }
+    ZPSO_Random random(seed);
+    auto pick = [&] {
+        size_t index = static_cast<size_t>(random.rand0_1() * freeCells.size());
+        return freeCells[min(index, freeCells.size() - 1)];
+    };
+    for (int i = 0; i < count; i++) {
+        PlanningProtocol::Request request;
+        request.id = to_string(i);
+        request.start = pick();
+        do {
+            request.goal = pick();
+        } while (request.goal.distanceTo(request.start) < map.getCellSize());
+        request.hasSeed = true;
+        request.seed = seed + static_cast<uint64_t>(i);
+        requests.push_back(request);
+    }
+    return requests;
+}
+
+static double percentile(vector<double>& sorted, double p) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t index = static_cast<size_t>(p * (sorted.size() - 1) + 0.5);
+    return sorted[min(index, sorted.size() - 1)];
+}
+
+int main(int argc, char** argv) {
+    const char* socketPath = nullptr;
+    const char* mapPath = "data/maps/map.txt";
+    int requestCount = 200;
+    int connections = 1;
+    int depth = 8;
+    int emitCount = 0;
+    uint64_t seed = 1;
+    for (int i = 1; i + 1 < argc; i++) {
+        if (strcmp(argv[i], "--socket") == 0) {
+            socketPath = argv[++i];
+        } else if (strcmp(argv[i], "--map") == 0) {
+            mapPath = argv[++i];
+        } else if (strcmp(argv[i], "--requests") == 0) {
+            requestCount = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--connections") == 0) {
+            connections = max(1, atoi(argv[++i]));
+        } else if (strcmp(argv[i], "--depth") == 0) {
+            depth = max(1, atoi(argv[++i]));
+        } else if (strcmp(argv[i], "--seed") == 0) {
+            seed = strtoull(argv[++i], nullptr, 10);
+        } else if (strcmp(argv[i], "--emit") == 0) {
+            emitCount = atoi(argv[++i]);
+        }
+    }
+
+    Map map(20, 20, 1.0);
+    if (!map.loadFromFile(mapPath)) {
+        cerr << "使用默认地图" << endl;
+    }
+
+    if (emitCount > 0) {
+        for (const auto& request : generateRequests(map, emitCount, seed)) {
+            cout << PlanningProtocol::formatRequest(request) << '\n';
+        }
+        return 0;
+    }
+    if (!socketPath) {
+        cerr << "用法: plan_loadgen --socket <路径> [--map <文件>] [--requests N] [--connections C] "
+                "[--depth D] [--seed S] | --emit N" << endl;
+        return 2;
+    }
+
+    vector<PlanningProtocol::Request> requests = generateRequests(map, requestCount, seed);
+    vector<Clock::time_point> sentAt(requests.size());
+    vector<double> latencies;
+    vector<double> planMs;
+    vector<double> queueMs;
+    int succeeded = 0;
+    int errors = 0;
+    int lost = 0;
+    mutex resultMutex;
+
+    // 每个连接负责下标 c, c+C, c+2C, ... 的请求，在途请求数不超过 depth
+    auto runConnection = [&](int connection) {
+        vector<size_t> mine;
+        for (size_t i = static_cast<size_t>(connection); i < requests.size(); i += static_cast<size_t>(connections)) {
+            mine.push_back(i);
+        }
+        int fd = UnixSocket::connectTo(socketPath);
+        if (fd < 0) {
+            lock_guard<mutex> lock(resultMutex);
+            lost += static_cast<int>(mine.size());
+            return;
+        }
+        UnixSocket::LineReader reader(fd);
+        size_t sent = 0, received = 0;
+        string line;
+        while (received < mine.size()) {
+            while (sent < mine.size() && sent - received < static_cast<size_t>(depth)) {
+                size_t index = mine[sent++];
+                sentAt[index] = Clock::now();
+                UnixSocket::writeAll(fd, PlanningProtocol::formatRequest(requests[index]) + "\n");
+            }
+            if (!reader.readLine(line)) {
+                break;
+            }
+            Clock::time_point now = Clock::now();
+            received++;
+            PlanningProtocol::Response response;
+            lock_guard<mutex> lock(resultMutex);
+            if (!PlanningProtocol::parseResponse(line, response) || !response.error.empty()) {
+                errors++;
+                continue;
+            }
+            size_t index = static_cast<size_t>(atoll(response.id.c_str()));
+            if (index < sentAt.size()) {
+                latencies.push_back(chrono::duration<double, milli>(now - sentAt[index]).count());
+            }
+            planMs.push_back(response.planMs);
+            queueMs.push_back(response.queueMs);
+            if (response.success) {
+                succeeded++;
+            }
+        }
+        ::close(fd);
+        lock_guard<mutex> lock(resultMutex);
+        lost += static_cast<int>(mine.size() - received);
+    };
+
+    Clock::time_point begin = Clock::now();
+    vector<thread> threads;
+    for (int c = 0; c < connections; c++) {
+        threads.emplace_back(runConnection, c);
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+    double seconds = chrono::duration<double>(Clock::now() - begin).count();
+
+    sort(latencies.begin(), latencies.end());
+    double planSum = 0.0, queueSum = 0.0;
+    for (size_t i = 0; i < planMs.size(); i++) {
+        planSum += planMs[i];
+        queueSum += queueMs[i];
+    }
+    size_t answered = max<size_t>(planMs.size(), 1);
+    cout << "requests: " << requests.size() << ", connections: " << connections << ", depth: " << depth << endl;
+    cout << "answered: " << planMs.size() << " (succeeded " << succeeded << "), errors: " << errors
+         << ", lost: " << lost << endl;
+    cout << fixed << setprecision(2);
+    cout << "wall: " << seconds * 1000.0 << " ms, throughput: " << planMs.size() / max(seconds, 1e-9) << " plans/s" << endl;
+    cout << "latency ms: p50 " << percentile(latencies, 0.50) << ", p90 " << percentile(latencies, 0.90)
+         << ", p99 " << percentile(latencies, 0.99) << ", max " << (latencies.empty() ? 0.0 : latencies.back()) << endl;
+    cout << "server ms: plan " << planSum / answered << ", queue " << queueSum / answered << " (mean)" << endl;
+    return errors == 0 && lost == 0 ? 0 : 1;
+}
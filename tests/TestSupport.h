@@ -0,0 +1,99 @@
+#ifndef TEST_SUPPORT_H
+#define TEST_SUPPORT_H
+
+#include "../include/Common.h"
+#include "../src/core/Map.h"
+#include "../src/algorithm/HybridAStarPSOAlgorithm.h"
+#include <iostream>
+#include <memory>
+
+/**
+ * 独立测试程序共用的检查函数与地图、算法、请求夹具
+ */
+
+// 打印一项检查的结果，失败时累加计数
+inline bool check(const char* name, bool ok, int& failures) {
+    std::cout << name << ": " << (ok ? "OK" : "FAILED") << std::endl;
+    if (!ok) {
+        failures++;
+    }
+    return ok;
+}
+
+// 只有边界墙的空地图
+inline void buildOpenMap(Map& map) {
+    for (int y = 0; y < map.getHeight(); y++) {
+        for (int x = 0; x < map.getWidth(); x++) {
+            bool border = x == 0 || y == 0 || x == map.getWidth() - 1 || y == map.getHeight() - 1;
+            map.setCell(x, y, border ? 1 : 0);
+        }
+    }
+}
+
+// 带边界的地图，中间一道竖墙只在 y < 4 处留有缺口，使A*需要扩展较多节点
+inline void buildWallMap(Map& map) {
+    buildOpenMap(map);
+    for (int y = 4; y < map.getHeight(); y++) {
+        map.setCell(map.getWidth() / 2, y, 1);
+    }
+}
+
+/**
+ * 带边界的地图，随机散布 blocks 个 2~6 格见方的矩形障碍（基准测试使用）
+ * @param seed 障碍布局的随机种子
+ * @param clearColumns 左右两侧至少保留的空旷列数（不含边界），为起终点留出通道
+ */
+inline void buildBlockMap(Map& map, uint64_t seed, int blocks, int clearColumns) {
+    buildOpenMap(map);
+    ZPSO_Random random(seed);
+    for (int block = 0; block < blocks; block++) {
+        int x0 = 4 + clearColumns + static_cast<int>(random.rand0_1() * (map.getWidth() - 12 - clearColumns));
+        int y0 = 4 + static_cast<int>(random.rand0_1() * (map.getHeight() - 12));
+        int w = 2 + static_cast<int>(random.rand0_1() * 5);
+        int h = 2 + static_cast<int>(random.rand0_1() * 5);
+        for (int y = y0; y < y0 + h && y < map.getHeight() - 1; y++) {
+            for (int x = x0; x < x0 + w && x < map.getWidth() - 1 - clearColumns; x++) {
+                map.setCell(x, y, 1);
+            }
+        }
+    }
+}
+
+/**
+ * 测试用的小规模参数：单线程评估、启用搜索走廊
+ * @param stallGenerations 停滞代数，<=0 时不启用停滞终止
+ */
+inline void configureTestAlgorithm(IPathPlanningAlgorithm& algorithm, int particleCount, int generations,
+                                   int stallGenerations) {
+    algorithm.setParameter("particleCount", particleCount);
+    algorithm.setParameter("generations", generations);
+    algorithm.setParameter("maxSpeed", 4.0);
+    algorithm.setParameter("corridorMargin", 3.0);
+    algorithm.setParameter("threadCount", 1);
+    if (stallGenerations > 0) {
+        algorithm.setParameter("stallGenerations", stallGenerations);
+        algorithm.setParameter("improvementThreshold", 1e-5);
+    }
+}
+
+// 热启动重新规划只运行 50 代的混合算法
+inline std::unique_ptr<HybridAStarPSOAlgorithm> createTestAlgorithm(int particleCount = 40, int generations = 150,
+                                                                    int stallGenerations = 30) {
+    auto algorithm = std::make_unique<HybridAStarPSOAlgorithm>();
+    configureTestAlgorithm(*algorithm, particleCount, generations, stallGenerations);
+    algorithm->setParameter("replanGenerations", 50);
+    return algorithm;
+}
+
+inline PathPlanningRequest makeRequest(Map& map, const Point& start, const Point& end, int numWaypoints = 5,
+                                       uint64_t seed = 3) {
+    PathPlanningRequest request;
+    request.startPoint = start;
+    request.endPoint = end;
+    request.map = &map;
+    request.numWaypoints = numWaypoints;
+    request.randomSeed = seed;
+    return request;
+}
+
+#endif // TEST_SUPPORT_H
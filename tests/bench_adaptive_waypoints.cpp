@@ -0,0 +1,64 @@
+#include "../include/Common.h"
+#include "../src/core/Logger.h"
+#include "../src/core/Map.h"
+#include "../src/algorithm/HybridAStarPSOAlgorithm.h"
+#include "TestSupport.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+// 固定航点数与自适应航点数在不同障碍密度地图上的成功率、路径长度与耗时
+// 每种密度生成若干张随机地图，每张地图用多个随机种子规划
+// 用法: bench_adaptive_waypoints [地图数=10] [每张地图的种子数=3] [固定航点数=6]
+
+int main(int argc, char** argv) {
+    int maps = argc > 1 ? std::atoi(argv[1]) : 10;
+    int seeds = argc > 2 ? std::atoi(argv[2]) : 3;
+    int fixedWaypoints = argc > 3 ? std::atoi(argv[3]) : 6;
+    Logger::instance().setLevel(LogLevel::Error);
+
+    std::cout << maps << " maps x " << seeds << " seeds per density" << std::endl;
+    std::cout << std::left << std::setw(10) << "blocks" << std::setw(12) << "mode" << std::setw(12) << "succeeded"
+              << std::setw(12) << "mean len" << std::setw(12) << "ms/plan" << "waypoints/plan" << std::endl;
+    for (int blocks : {5, 24, 60}) {
+        for (bool adaptive : {false, true}) {
+            int plans = 0, succeeded = 0, waypoints = 0;
+            double lengthSum = 0.0, seconds = 0.0;
+            for (int m = 0; m < maps; m++) {
+                Map map(60, 60, 1.0);
+                buildBlockMap(map, 100 + m, blocks, 4);
+                HybridAStarPSOAlgorithm algorithm;
+                algorithm.setParameter("particleCount", 150);
+                algorithm.setParameter("generations", 300);
+                algorithm.setParameter("maxSpeed", 4.0);
+                algorithm.setParameter("corridorMargin", 3.0);
+                algorithm.setParameter("stallGenerations", 60);
+                algorithm.setParameter("improvementThreshold", 1e-5);
+                algorithm.setParameter("adaptiveWaypoints", adaptive ? 1 : 0);
+                PathPlanningRequest request;
+                request.startPoint = Point(2.5, 2.5);
+                request.endPoint = Point(57.5, 57.5);
+                request.map = &map;
+                request.numWaypoints = fixedWaypoints;
+                for (int s = 1; s <= seeds; s++) {
+                    request.randomSeed = s;
+                    auto begin = std::chrono::steady_clock::now();
+                    PathPlanningResult result = algorithm.planPath(request);
+                    seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+                    plans++;
+                    waypoints += static_cast<int>(result.path.size()) - 2;
+                    if (result.success) {
+                        succeeded++;
+                        lengthSum += result.pathLength;
+                    }
+                }
+            }
+            std::cout << std::left << std::setw(10) << blocks << std::setw(12) << (adaptive ? "adaptive" : "fixed")
+                      << std::setw(12) << (std::to_string(succeeded) + "/" + std::to_string(plans))
+                      << std::fixed << std::setprecision(2) << std::setw(12) << lengthSum / std::max(succeeded, 1)
+                      << std::setw(12) << seconds * 1000.0 / plans
+                      << std::setprecision(1) << static_cast<double>(waypoints) / plans << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,67 @@
+#include "../src/algorithm/ZPSOAlgorithm.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+// 同步（按代屏障）与异步（稳态）粒子群的吞吐量对比
+// 适应度代价不均匀：约5%的评估耗时为其余的20倍，模拟碰撞检测代价悬殊的路径，
+// 同步模式每代都要等待最慢的粒子，异步模式下线程评估完即领取下一个粒子
+// 用法: bench_async_pso [线程数=硬件并发数] [粒子数=64] [进化代数=200]
+
+constexpr int DIMENSION = 12;
+
+static double unevenSphere(const double* position, int dimension) {
+    double sum = 0.0;
+    for (int j = 0; j < dimension; j++) {
+        sum += position[j] * position[j];
+    }
+    // 由位置派生的伪随机数决定本次评估的代价
+    uint64_t bits = static_cast<uint64_t>(std::fabs(position[0]) * 1e9) * 0x9E3779B97F4A7C15ULL;
+    int rounds = (bits >> 58) < 3 ? 20000 : 1000;
+    volatile double sink = 0.0;
+    for (int k = 0; k < rounds; k++) {
+        sink = sink + std::sqrt(static_cast<double>(k));
+    }
+    return -sum;
+}
+
+static void runBenchmark(bool async, ThreadPool& pool, int particles, int generations) {
+    double minBounds[DIMENSION];
+    double maxBounds[DIMENSION];
+    for (int j = 0; j < DIMENSION; j++) {
+        minBounds[j] = -10.0;
+        maxBounds[j] = 10.0;
+    }
+    ZPSO_Algorithm swarm([](ZPSO_Partical& p) { return unevenSphere(p._position.data(), p.getDimension()); },
+                         minBounds, maxBounds, DIMENSION, particles, 2.0, 2.0, 1.0, 11);
+    swarm.setThreadPool(&pool);
+
+    ZPSO_Partical best(DIMENSION);
+    auto begin = std::chrono::steady_clock::now();
+    if (async) {
+        swarm.findMaxAsync(generations, best);
+    } else {
+        swarm.findMax(generations, best);
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    double evaluations = static_cast<double>(swarm._generationsUsed + 1) * particles;
+    std::cout << std::left << std::setw(14) << (async ? "async" : "synchronous")
+              << std::setw(12) << std::fixed << std::setprecision(1) << seconds * 1000.0
+              << std::setw(16) << std::setprecision(0) << evaluations / seconds
+              << std::scientific << std::setprecision(3) << best._fitness << std::endl;
+}
+
+int main(int argc, char** argv) {
+    int threads = argc > 1 ? std::atoi(argv[1]) : 0;
+    int particles = argc > 2 ? std::atoi(argv[2]) : 64;
+    int generations = argc > 3 ? std::atoi(argv[3]) : 200;
+
+    ThreadPool pool(threads);
+    std::cout << "dimension " << DIMENSION << ", " << pool.getThreadCount() << " threads, " << particles
+              << " particles, " << generations << " generations" << std::endl;
+    std::cout << std::left << std::setw(14) << "mode" << std::setw(12) << "time(ms)"
+              << std::setw(16) << "evaluations/s" << "best fitness" << std::endl;
+    runBenchmark(false, pool, particles, generations);
+    runBenchmark(true, pool, particles, generations);
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include "../include/Common.h"
+#include "../src/core/Logger.h"
+#include "../src/core/Map.h"
+#include "../src/core/PathPlanner.h"
+#include "../src/algorithm/HybridAStarPSOAlgorithm.h"
+#include "TestSupport.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+// 批量规划吞吐量随线程数的变化（1 到 N 线程）
+// 所有请求共享同一张只读地图，每个线程独占一个算法实例（算法内部单线程）；
+// 同时校验各线程数下的规划结果与单线程完全一致
+// 用法: bench_batch_planning [最大线程数=硬件并发数] [请求数=128] [重复次数=3]
+
+static Point randomFreePoint(const Map& map, ZPSO_Random& random) {
+    for (;;) {
+        Point p(1.5 + random.rand0_1() * (map.getWidth() - 3), 1.5 + random.rand0_1() * (map.getHeight() - 3));
+        if (!map.isObstacle(p.x, p.y)) {
+            return p;
+        }
+    }
+}
+
+static std::unique_ptr<IPathPlanningAlgorithm> createAlgorithm() {
+    auto algorithm = std::make_unique<HybridAStarPSOAlgorithm>();
+    algorithm->setParameter("particleCount", 60);
+    algorithm->setParameter("generations", 150);
+    algorithm->setParameter("maxSpeed", 4.0);
+    algorithm->setParameter("stallGenerations", 40);
+    algorithm->setParameter("improvementThreshold", 1e-5);
+    algorithm->setParameter("corridorMargin", 3.0);
+    algorithm->setParameter("threadCount", 1);
+    return algorithm;
+}
+
+int main(int argc, char** argv) {
+    int maxThreads = argc > 1 ? std::atoi(argv[1]) : static_cast<int>(std::thread::hardware_concurrency());
+    int requestCount = argc > 2 ? std::atoi(argv[2]) : 128;
+    int repeats = argc > 3 ? std::atoi(argv[3]) : 3;
+    maxThreads = std::max(maxThreads, 1);
+    Logger::instance().setLevel(LogLevel::Warn);
+
+    Map map(60, 60, 1.0);
+    buildBlockMap(map, 2024, 24, 0);
+    ZPSO_Random random(7);
+    std::vector<PathPlanningRequest> requests(requestCount);
+    for (int i = 0; i < requestCount; i++) {
+        requests[i].startPoint = randomFreePoint(map, random);
+        requests[i].endPoint = randomFreePoint(map, random);
+        requests[i].numWaypoints = 5;
+        requests[i].randomSeed = 1000 + i;
+    }
+
+    PathPlanner planner(&map, Point(0, 0), Point(0, 0), createAlgorithm());
+    std::cout << requestCount << " requests, " << repeats << " repeats" << std::endl;
+    std::cout << std::left << std::setw(10) << "threads" << std::setw(14) << "plans/s"
+              << std::setw(10) << "speedup" << std::setw(12) << "succeeded" << "identical" << std::endl;
+
+    std::vector<PathPlanningResult> reference;
+    double baseline = 0.0;
+    // 线程数依次取 1, 2, 4, ... 直到 maxThreads
+    for (int threads = 1; threads <= maxThreads; threads = (threads == maxThreads) ? threads + 1 : std::min(threads * 2, maxThreads)) {
+        planner.setBatchAlgorithmFactory(createAlgorithm, threads);
+        double best = INFINITY;
+        std::vector<PathPlanningResult> results;
+        for (int r = 0; r < repeats; r++) {
+            auto begin = std::chrono::steady_clock::now();
+            results = planner.planBatch(requests);
+            best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count());
+        }
+
+        if (reference.empty()) {
+            reference = results;
+            baseline = best;
+        }
+        int succeeded = 0;
+        bool identical = true;
+        for (int i = 0; i < requestCount; i++) {
+            succeeded += results[i].success ? 1 : 0;
+            identical = identical && results[i].fitness == reference[i].fitness &&
+                        results[i].path.size() == reference[i].path.size();
+        }
+        std::cout << std::left << std::setw(10) << planner.getBatchThreadCount()
+                  << std::setw(14) << std::fixed << std::setprecision(1) << requestCount / best
+                  << std::setw(10) << std::setprecision(2) << baseline / best
+                  << std::setw(12) << (std::to_string(succeeded) + "/" + std::to_string(requestCount))
+                  << (identical ? "yes" : "NO") << std::endl;
+    }
+    return 0;
+}
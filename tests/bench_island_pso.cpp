@@ -0,0 +1,110 @@
+#include "../include/Common.h"
+#include "../src/core/Map.h"
+#include "../src/algorithm/HybridAStarPSOAlgorithm.h"
+#include "../src/algorithm/IslandPSOAlgorithm.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+// 岛屿模型与单一大种群的"达到目标适应度所需时间"对比
+// 用法: bench_island_pso [岛屿数=4] [重复次数=5]
+
+// 构造一张带多道错位隔墙的 60x60 地图
+static void buildBenchmarkMap(Map& map) {
+    for (int y = 0; y < map.getHeight(); y++) {
+        for (int x = 0; x < map.getWidth(); x++) {
+            bool border = x == 0 || y == 0 || x == map.getWidth() - 1 || y == map.getHeight() - 1;
+            map.setCell(x, y, border ? 1 : 0);
+        }
+    }
+    for (int wall = 1; wall <= 3; wall++) {
+        int x = wall * 15;
+        int gapY = (wall % 2 == 1) ? 50 : 8;
+        for (int y = 1; y < map.getHeight() - 1; y++) {
+            if (y < gapY - 3 || y > gapY + 3) {
+                map.setCell(x, y, 1);
+            }
+        }
+    }
+}
+
+// 运行一次规划并计时（算法内部的日志在 main 中已调到警告级别）
+static PathPlanningResult quietPlan(IPathPlanningAlgorithm& algorithm, const PathPlanningRequest& request,
+                                    double& seconds) {
+    auto begin = std::chrono::steady_clock::now();
+    PathPlanningResult result = algorithm.planPath(request);
+    seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    return result;
+}
+
+static void configure(IPathPlanningAlgorithm& algorithm, int generations) {
+    algorithm.setParameter("particleCount", 160);
+    algorithm.setParameter("generations", generations);
+    algorithm.setParameter("maxSpeed", 4.0);
+}
+
+int main(int argc, char** argv) {
+    int islands = argc > 1 ? std::atoi(argv[1]) : 4;
+    int repeats = argc > 2 ? std::atoi(argv[2]) : 5;
+    Logger::instance().setLevel(LogLevel::Warn);
+
+    Map map(60, 60, 1.0);
+    buildBenchmarkMap(map);
+
+    PathPlanningRequest request;
+    request.startPoint = Point(3.0, 3.0);
+    request.endPoint = Point(56.0, 56.0);
+    request.map = &map;
+    request.numWaypoints = 8;
+    request.maxTime = 60.0;
+
+    // 以单一大种群长时间运行的最差结果作为目标适应度
+    double target = 1e300;
+    for (int r = 0; r < repeats; r++) {
+        HybridAStarPSOAlgorithm reference;
+        configure(reference, 600);
+        request.randomSeed = 1000 + r;
+        double seconds = 0.0;
+        target = std::min(target, quietPlan(reference, request, seconds).fitness);
+    }
+    std::cout << "target fitness: " << std::fixed << std::setprecision(3) << target << std::endl;
+    std::cout << std::left << std::setw(22) << "configuration" << std::setw(12) << "reached"
+              << std::setw(14) << "generations" << "time(ms)" << std::endl;
+
+    for (int variant = 0; variant < 2; variant++) {
+        int reached = 0;
+        double totalSeconds = 0.0;
+        double totalGenerations = 0.0;
+        for (int r = 0; r < repeats; r++) {
+            std::unique_ptr<IPathPlanningAlgorithm> algorithm;
+            if (variant == 0) {
+                algorithm = std::make_unique<HybridAStarPSOAlgorithm>();
+            } else {
+                algorithm = std::make_unique<IslandPSOAlgorithm>();
+                algorithm->setParameter("islandCount", islands);
+            }
+            configure(*algorithm, 600);
+            algorithm->setParameter("targetFitness", target);
+            request.randomSeed = r + 1;
+            double seconds = 0.0;
+            PathPlanningResult result = quietPlan(*algorithm, request, seconds);
+            if (result.terminationReason == TerminationReason::TargetReached) {
+                reached++;
+            }
+            totalSeconds += seconds;
+            totalGenerations += result.iterations;
+        }
+        std::ostringstream name;
+        if (variant == 0) {
+            name << "single swarm x160";
+        } else {
+            name << islands << " islands x" << 160 / islands;
+        }
+        std::cout << std::left << std::setw(22) << name.str()
+                  << std::setw(12) << (std::to_string(reached) + "/" + std::to_string(repeats))
+                  << std::setw(14) << std::setprecision(1) << totalGenerations / repeats
+                  << std::setprecision(2) << totalSeconds * 1000.0 / repeats << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,106 @@
+#include "../include/Common.h"
+#include "../src/core/Map.h"
+#include "../src/algorithm/CooperativeAStarPlanner.h"
+#include "../src/algorithm/ZPSOAlgorithm.h"
+#include <iomanip>
+#include <iostream>
+
+// 多机器人规划吞吐量：10~500 个机器人在仓库货架地图与 data/maps 地图上的规划耗时与路径质量
+// 优先级规划测全部规模，CBS 只测 50 个以内（超出节点/时间上限记为失败）
+// 用法: bench_multi_robot [地图文件=data/maps/map.txt] [随机种子=1]
+
+static void buildWarehouse(Map& map) {
+    // 64x64 仓库：2格宽的货架列，每隔8行留一条横向通道
+    for (int y = 0; y < map.getHeight(); y++) {
+        for (int x = 0; x < map.getWidth(); x++) {
+            bool border = x == 0 || y == 0 || x == map.getWidth() - 1 || y == map.getHeight() - 1;
+            bool shelf = x >= 3 && x < map.getWidth() - 3 && x % 4 < 2 && y >= 3 && y < map.getHeight() - 3 && y % 8 != 0;
+            map.setCell(x, y, border || shelf ? 1 : 0);
+        }
+    }
+}
+
+// 随机取 count 组互不相同的起点与终点
+static std::vector<MultiAgentTask> randomTasks(const Map& map, int count, uint64_t seed) {
+    ZPSO_Random random(seed);
+    std::vector<char> usedStart(map.getWidth() * map.getHeight(), 0);
+    std::vector<char> usedGoal(usedStart.size(), 0);
+    std::vector<MultiAgentTask> tasks;
+    auto pick = [&](std::vector<char>& used) {
+        for (;;) {
+            int x = static_cast<int>(random.rand0_1() * map.getWidth());
+            int y = static_cast<int>(random.rand0_1() * map.getHeight());
+            if (map.getCell(x, y) == 0 && !used[y * map.getWidth() + x]) {
+                used[y * map.getWidth() + x] = 1;
+                return Point((x + 0.5) * map.getCellSize(), (y + 0.5) * map.getCellSize());
+            }
+        }
+    };
+    for (int i = 0; i < count; i++) {
+        Point start = pick(usedStart);
+        tasks.emplace_back(start, pick(usedGoal));
+    }
+    return tasks;
+}
+
+static int freeCells(const Map& map) {
+    int count = 0;
+    for (int y = 0; y < map.getHeight(); y++) {
+        for (int x = 0; x < map.getWidth(); x++) {
+            count += map.getCell(x, y) == 0 ? 1 : 0;
+        }
+    }
+    return count;
+}
+
+static void runMap(const char* name, const Map& map, uint64_t seed) {
+    int capacity = freeCells(map) / 3;  // 机器人数不超过空闲网格的三分之一
+    std::cout << name << " (" << map.getWidth() << "x" << map.getHeight() << ", " << freeCells(map)
+              << " free cells)" << std::endl;
+    std::cout << std::left << std::setw(8) << "agents" << std::setw(12) << "mode" << std::setw(12) << "ms"
+              << std::setw(14) << "agents/s" << std::setw(10) << "solved" << std::setw(10) << "SOC"
+              << std::setw(10) << "makespan" << std::setw(14) << "A* nodes" << "conflicts" << std::endl;
+
+    CooperativeAStarPlanner planner;
+    planner.setSearchLimits(2000, 5.0);
+    for (int agents : {10, 25, 50, 100, 200, 500}) {
+        if (agents > capacity) {
+            break;
+        }
+        std::vector<MultiAgentTask> tasks = randomTasks(map, agents, seed + agents);
+        for (MultiAgentMode mode : {MultiAgentMode::Prioritized, MultiAgentMode::ConflictBasedSearch}) {
+            if (mode == MultiAgentMode::ConflictBasedSearch && agents > 50) {
+                continue;
+            }
+            planner.setMode(mode);
+            MultiAgentResult result = planner.plan(map, tasks);
+            CooperativeAStarPlanner::Conflict conflict;
+            bool conflicted = planner.findConflict(map, result, conflict);
+            std::cout << std::left << std::setw(8) << agents
+                      << std::setw(12) << (mode == MultiAgentMode::Prioritized ? "prioritized" : "CBS")
+                      << std::setw(12) << std::fixed << std::setprecision(2) << result.computationTime * 1000.0
+                      << std::setw(14) << std::setprecision(0) << result.solvedAgents / std::max(result.computationTime, 1e-9)
+                      << std::setw(10) << (std::to_string(result.solvedAgents) + "/" + std::to_string(agents))
+                      << std::setw(10) << result.sumOfCosts << std::setw(10) << result.makespan
+                      << std::setw(14) << result.nodesExpanded << (conflicted ? "YES" : "none") << std::endl;
+        }
+    }
+    std::cout << std::endl;
+}
+
+int main(int argc, char** argv) {
+    std::string mapFile = argc > 1 ? argv[1] : "data/maps/map.txt";
+    uint64_t seed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1;
+
+    Map warehouse(64, 64, 1.0);
+    buildWarehouse(warehouse);
+    runMap("warehouse", warehouse, seed);
+
+    Map fileMap;
+    if (fileMap.loadFromFile(mapFile)) {
+        runMap(mapFile.c_str(), fileMap, seed);
+    } else {
+        std::cout << "cannot load " << mapFile << ", skipped" << std::endl;
+    }
+    return 0;
+}
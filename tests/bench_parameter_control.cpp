@@ -0,0 +1,141 @@
+#include "../include/Common.h"
+#include "../src/core/Map.h"
+#include "../src/algorithm/HybridAStarPSOAlgorithm.h"
+#include <iomanip>
+#include <iostream>
+
+// 各参数控制方式的收敛速度对比：
+//   首次可行代数：全局最优路径无碰撞且全部航点在地图内的最早代数
+//   1%代数：全局最优适应度进入该场景、该种子下所有方式最终最优值1%以内的最早代数
+// 用法: bench_parameter_control [重复次数=5] [进化代数=300]
+
+static const char* SCHEME_NAMES[] = {"fixed", "linear inertia", "constriction", "success rate"};
+constexpr int SCHEME_COUNT = 4;
+
+struct Scenario {
+    const char* name;
+    Map map;
+    Point start;
+    Point end;
+};
+
+static void clearWithBorder(Map& map) {
+    for (int y = 0; y < map.getHeight(); y++) {
+        for (int x = 0; x < map.getWidth(); x++) {
+            bool border = x == 0 || y == 0 || x == map.getWidth() - 1 || y == map.getHeight() - 1;
+            map.setCell(x, y, border ? 1 : 0);
+        }
+    }
+}
+
+static void buildScenarios(std::vector<Scenario>& scenarios) {
+    scenarios.push_back({"default 20x20", Map(), Point(2.0, 2.0), Point(17.0, 17.0)});
+
+    Scenario block{"open 40x40 block", Map(40, 40, 1.0), Point(3.0, 3.0), Point(36.0, 36.0)};
+    clearWithBorder(block.map);
+    for (int y = 14; y < 26; y++) {
+        for (int x = 14; x < 26; x++) {
+            block.map.setCell(x, y, 1);
+        }
+    }
+    scenarios.push_back(block);
+
+    Scenario walls{"walls 60x60", Map(60, 60, 1.0), Point(3.0, 3.0), Point(56.0, 56.0)};
+    clearWithBorder(walls.map);
+    for (int wall = 1; wall <= 3; wall++) {
+        int gapY = (wall % 2 == 1) ? 50 : 8;
+        for (int y = 1; y < 59; y++) {
+            if (y < gapY - 3 || y > gapY + 3) {
+                walls.map.setCell(wall * 15, y, 1);
+            }
+        }
+    }
+    scenarios.push_back(walls);
+}
+
+static bool isFeasible(const Map& map, const std::vector<Point>& path) {
+    for (size_t i = 0; i < path.size(); i++) {
+        if (!map.isInBounds(path[i].x, path[i].y) || (i > 0 && map.isLineColliding(path[i - 1], path[i]))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char** argv) {
+    int repeats = argc > 1 ? std::atoi(argv[1]) : 5;
+    int generations = argc > 2 ? std::atoi(argv[2]) : 300;
+    Logger::instance().setLevel(LogLevel::Warn);  // 屏蔽算法内部的规划日志
+
+    std::vector<Scenario> scenarios;
+    buildScenarios(scenarios);
+
+    std::cout << std::left << std::setw(20) << "scenario" << std::setw(18) << "scheme"
+              << std::setw(12) << "feasible" << std::setw(16) << "gen-feasible"
+              << std::setw(12) << "within 1%" << std::setw(14) << "gen-1%" << "final fitness" << std::endl;
+
+    for (Scenario& scenario : scenarios) {
+        // 每个种子、每种方式的全局最优适应度曲线与可行性曲线
+        std::vector<std::vector<std::vector<double>>> fitnessCurve(SCHEME_COUNT);
+        std::vector<std::vector<int>> firstFeasible(SCHEME_COUNT, std::vector<int>(repeats, -1));
+        for (int scheme = 0; scheme < SCHEME_COUNT; scheme++) {
+            fitnessCurve[scheme].resize(repeats);
+            for (int r = 0; r < repeats; r++) {
+                HybridAStarPSOAlgorithm algorithm;
+                algorithm.setParameter("particleCount", 100);
+                algorithm.setParameter("generations", generations);
+                algorithm.setParameter("maxSpeed", 4.0);
+                algorithm.setParameter("corridorMargin", 3.0);
+                algorithm.setParameter("parameterControl", scheme);
+                std::vector<double>& curve = fitnessCurve[scheme][r];
+                int& feasibleAt = firstFeasible[scheme][r];
+                algorithm.setGenerationObserver([&](int generation, double fitness, const std::vector<Point>& path) {
+                    curve.push_back(fitness);
+                    if (feasibleAt < 0 && isFeasible(scenario.map, path)) {
+                        feasibleAt = generation;
+                    }
+                });
+
+                PathPlanningRequest request;
+                request.startPoint = scenario.start;
+                request.endPoint = scenario.end;
+                request.map = &scenario.map;
+                request.numWaypoints = 5;
+                request.randomSeed = 100 + r;
+                algorithm.planPath(request);
+            }
+        }
+
+        for (int scheme = 0; scheme < SCHEME_COUNT; scheme++) {
+            int feasibleRuns = 0, nearRuns = 0;
+            double feasibleSum = 0.0, nearSum = 0.0, finalSum = 0.0;
+            for (int r = 0; r < repeats; r++) {
+                double best = -INFINITY;
+                for (int other = 0; other < SCHEME_COUNT; other++) {
+                    best = std::max(best, fitnessCurve[other][r].back());
+                }
+                const std::vector<double>& curve = fitnessCurve[scheme][r];
+                for (size_t g = 0; g < curve.size(); g++) {
+                    if (curve[g] >= best - 0.01 * std::fabs(best)) {
+                        nearRuns++;
+                        nearSum += static_cast<double>(g + 1);
+                        break;
+                    }
+                }
+                if (firstFeasible[scheme][r] >= 0) {
+                    feasibleRuns++;
+                    feasibleSum += firstFeasible[scheme][r];
+                }
+                finalSum += curve.back();
+            }
+            std::cout << std::left << std::setw(20) << scenario.name << std::setw(18) << SCHEME_NAMES[scheme]
+                      << std::setw(12) << (std::to_string(feasibleRuns) + "/" + std::to_string(repeats))
+                      << std::setw(16) << std::fixed << std::setprecision(1)
+                      << (feasibleRuns > 0 ? feasibleSum / feasibleRuns : NAN)
+                      << std::setw(12) << (std::to_string(nearRuns) + "/" + std::to_string(repeats))
+                      << std::setw(14) << (nearRuns > 0 ? nearSum / nearRuns : NAN)
+                      << std::setprecision(2) << finalSum / repeats << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include "../include/Common.h"
+#include "../src/core/Logger.h"
+#include "../src/core/Map.h"
+#include "../src/core/PathPostProcessor.h"
+#include "../src/algorithm/HybridAStarPSOAlgorithm.h"
+#include "TestSupport.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+// 削减 PSO 进化代数后由路径后处理补足路径质量：各代数下规划与后处理的耗时和路径长度，
+// 以及只对 A* 引导路径做后处理（不运行 PSO）的结果
+// 用法: bench_post_processing [重复次数=5]
+
+static double pathLength(const std::vector<Point>& path) {
+    double length = 0.0;
+    for (size_t i = 1; i < path.size(); i++) {
+        length += path[i-1].distanceTo(path[i]);
+    }
+    return length;
+}
+
+struct Row {
+    double planMs = 0.0;
+    double postMs = 0.0;
+    double rawLength = 0.0;
+    double shortcutLength = 0.0;
+    double smoothLength = 0.0;
+    int succeeded = 0;
+};
+
+int main(int argc, char** argv) {
+    int repeats = argc > 1 ? std::atoi(argv[1]) : 5;
+    Logger::instance().setLevel(LogLevel::Error);
+
+    Map map(60, 60, 1.0);
+    buildBlockMap(map, 2024, 24, 4);
+    PathPlanningRequest request;
+    request.startPoint = Point(2.5, 2.5);
+    request.endPoint = Point(57.5, 57.5);
+    request.map = &map;
+    request.numWaypoints = 6;
+
+    PathPostProcessor shortcut;
+    PostProcessingOptions smoothOptions;
+    smoothOptions.smoothing = true;
+    PathPostProcessor smooth(smoothOptions);
+
+    std::cout << "mean of " << repeats << " seeds" << std::endl;
+    std::cout << std::left << std::setw(14) << "generations" << std::setw(12) << "plan ms" << std::setw(12) << "post ms"
+              << std::setw(12) << "raw len" << std::setw(14) << "shortcut len" << std::setw(12) << "smooth len"
+              << "succeeded" << std::endl;
+    for (int generations : {300, 100, 50, 25, 0}) {
+        HybridAStarPSOAlgorithm algorithm;
+        algorithm.setParameter("particleCount", 100);
+        algorithm.setParameter("generations", std::max(generations, 1));
+        algorithm.setParameter("maxSpeed", 4.0);
+        algorithm.setParameter("corridorMargin", 3.0);
+        algorithm.setParameter("threadCount", 1);
+
+        Row row;
+        for (int r = 0; r < repeats; r++) {
+            request.randomSeed = 1 + r;
+            auto begin = std::chrono::steady_clock::now();
+            PathPlanningResult result = algorithm.planPath(request);
+            row.planMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+            // 代数为 0 表示只用 A* 引导路径
+            const std::vector<Point>& raw = generations == 0 ? result.guidePath : result.path;
+            if (raw.size() < 2 || (generations > 0 && !result.success)) {
+                continue;
+            }
+            begin = std::chrono::steady_clock::now();
+            std::vector<Point> shortened = shortcut.process(map, raw);
+            std::vector<Point> smoothed = smooth.process(map, raw);
+            row.postMs += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+            row.rawLength += pathLength(raw);
+            row.shortcutLength += pathLength(shortened);
+            row.smoothLength += pathLength(smoothed);
+            row.succeeded++;
+        }
+        int n = std::max(row.succeeded, 1);
+        std::cout << std::left << std::setw(14) << (generations == 0 ? std::string("A* guide") : std::to_string(generations))
+                  << std::fixed << std::setprecision(3) << std::setw(12) << row.planMs / repeats
+                  << std::setw(12) << row.postMs / n << std::setprecision(2)
+                  << std::setw(12) << row.rawLength / n << std::setw(14) << row.shortcutLength / n
+                  << std::setw(12) << row.smoothLength / n << row.succeeded << "/" << repeats << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,49 @@
+#include "../src/algorithm/ZPSOAlgorithm.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+// 运行时维度与编译期维度（双精度/单精度）PSO引擎的单代耗时对比
+// 目标函数为廉价的球函数，使耗时主要来自引擎本身的速度与位置更新
+// 用法: bench_pso_dimension [粒子数=200] [进化代数=2000]
+
+constexpr int DIMENSION = 12;
+
+template <int D, typename Real>
+static void runBenchmark(const char* name, int particles, int generations) {
+    double minBounds[DIMENSION];
+    double maxBounds[DIMENSION];
+    for (int j = 0; j < DIMENSION; j++) {
+        minBounds[j] = -10.0;
+        maxBounds[j] = 10.0;
+    }
+    using Swarm = ZPSO_AlgorithmT<D, Real>;
+    Swarm swarm([](typename Swarm::Partical& p) {
+        double sum = 0.0;
+        for (int j = 0; j < p.getDimension(); j++) {
+            sum += static_cast<double>(p._position[j]) * p._position[j];
+        }
+        return -sum;
+    }, minBounds, maxBounds, DIMENSION, particles, 2.0, 2.0, 1.0, 7);
+
+    typename Swarm::Partical best(DIMENSION);
+    auto begin = std::chrono::steady_clock::now();
+    swarm.findMax(generations, best);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+    std::cout << std::left << std::setw(22) << name << std::setw(16) << std::setprecision(3)
+              << seconds * 1e6 / generations << best._fitness << std::endl;
+}
+
+int main(int argc, char** argv) {
+    int particles = argc > 1 ? std::atoi(argv[1]) : 200;
+    int generations = argc > 2 ? std::atoi(argv[2]) : 2000;
+
+    std::cout << "dimension " << DIMENSION << ", " << particles << " particles, "
+              << generations << " generations" << std::endl;
+    std::cout << std::left << std::setw(22) << "engine" << std::setw(16) << "us/generation"
+              << "best fitness" << std::endl;
+    runBenchmark<0, double>("dynamic double", particles, generations);
+    runBenchmark<DIMENSION, double>("static double", particles, generations);
+    runBenchmark<DIMENSION, float>("static float", particles, generations);
+    return 0;
+}
@@ -0,0 +1,123 @@
+#include "../include/Common.h"
+#include "../src/core/Logger.h"
+#include "../src/core/Map.h"
+#include "../src/algorithm/HybridAStarPSOAlgorithm.h"
+#include "TestSupport.h"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+// 机器人沿规划出的路径逐步前进时，冷启动重新规划与热启动重新规划的耗时与路径质量对比
+// 每一步起点沿上一步的路径前进 stepLength，终点不变
+// 用法: bench_replanning [步数=20] [步长=1.0] [重复次数=3]
+
+static void configure(IPathPlanningAlgorithm& algorithm) {
+    algorithm.setParameter("particleCount", 100);
+    algorithm.setParameter("generations", 300);
+    algorithm.setParameter("maxSpeed", 4.0);
+    algorithm.setParameter("stallGenerations", 60);
+    algorithm.setParameter("improvementThreshold", 1e-5);
+    algorithm.setParameter("corridorMargin", 3.0);
+    algorithm.setParameter("replanGenerations", 100);
+    algorithm.setParameter("threadCount", 1);
+}
+
+// 沿路径前进给定距离后的位置
+static Point pointAlong(const std::vector<Point>& path, double distance) {
+    for (size_t i = 1; i < path.size(); i++) {
+        double length = path[i-1].distanceTo(path[i]);
+        if (distance <= length) {
+            double t = distance / length;
+            return Point(path[i-1].x + t * (path[i].x - path[i-1].x), path[i-1].y + t * (path[i].y - path[i-1].y));
+        }
+        distance -= length;
+    }
+    return path.back();
+}
+
+struct RunSummary {
+    double seconds = 0.0;
+    double fitnessSum = 0.0;
+    uint64_t nodesExpanded = 0;
+    int generations = 0;
+    int succeeded = 0;
+};
+
+// 从同一个初始规划出发走 steps 步，warm 为真时每步用上一步的结果热启动
+static RunSummary walk(Map& map, const PathPlanningResult& initial, int steps, double stepLength, bool warm) {
+    HybridAStarPSOAlgorithm algorithm;
+    configure(algorithm);
+    RunSummary summary;
+    PathPlanningResult previous = initial;
+    for (int i = 0; i < steps; i++) {
+        PathPlanningRequest request;
+        request.startPoint = pointAlong(previous.path, stepLength);
+        request.endPoint = previous.path.back();
+        request.map = &map;
+        request.numWaypoints = static_cast<int>(previous.path.size()) - 2;
+        request.randomSeed = 100 + i;
+
+        auto begin = std::chrono::steady_clock::now();
+        PathPlanningResult result = warm ? algorithm.replanPath(request, previous) : algorithm.planPath(request);
+        summary.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        summary.fitnessSum += result.fitness;
+        summary.nodesExpanded += result.stats.nodesExpanded;
+        summary.generations += result.iterations;
+        summary.succeeded += result.success ? 1 : 0;
+        if (!result.success) {
+            break;  // 机器人只沿可通行的路径前进
+        }
+        previous = result;
+    }
+    return summary;
+}
+
+int main(int argc, char** argv) {
+    int steps = argc > 1 ? std::atoi(argv[1]) : 20;
+    double stepLength = argc > 2 ? std::atof(argv[2]) : 1.0;
+    int repeats = argc > 3 ? std::atoi(argv[3]) : 3;
+    Logger::instance().setLevel(LogLevel::Error);
+
+    Map map(60, 60, 1.0);
+    buildBlockMap(map, 2024, 24, 4);
+    HybridAStarPSOAlgorithm algorithm;
+    configure(algorithm);
+    PathPlanningRequest request;
+    request.startPoint = Point(2.5, 2.5);
+    request.endPoint = Point(57.5, 57.5);
+    request.map = &map;
+    request.numWaypoints = 6;
+    PathPlanningResult initial = algorithm.planPath(request);
+    if (!initial.success) {
+        std::cout << "initial plan failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << steps << " steps of " << stepLength << ", best of " << repeats << " runs" << std::endl;
+    std::cout << std::left << std::setw(8) << "mode" << std::setw(12) << "ms/plan" << std::setw(14) << "A* nodes/plan"
+              << std::setw(14) << "gens/plan" << std::setw(14) << "mean fitness" << "succeeded" << std::endl;
+    double coldSeconds = 0.0;
+    for (bool warm : {false, true}) {
+        RunSummary best;
+        best.seconds = INFINITY;
+        for (int r = 0; r < repeats; r++) {
+            RunSummary summary = walk(map, initial, steps, stepLength, warm);
+            if (summary.seconds < best.seconds) {
+                best = summary;
+            }
+        }
+        int plans = std::max(best.succeeded + (best.succeeded < steps ? 1 : 0), 1);
+        std::cout << std::left << std::setw(8) << (warm ? "warm" : "cold")
+                  << std::setw(12) << std::fixed << std::setprecision(2) << best.seconds * 1000.0 / plans
+                  << std::setw(14) << best.nodesExpanded / plans
+                  << std::setw(14) << std::setprecision(1) << static_cast<double>(best.generations) / plans
+                  << std::setw(14) << std::setprecision(2) << best.fitnessSum / plans
+                  << best.succeeded << "/" << steps << std::endl;
+        if (!warm) {
+            coldSeconds = best.seconds / plans;
+        } else {
+            std::cout << "warm/cold time ratio: " << std::setprecision(2) << best.seconds / plans / coldSeconds << std::endl;
+        }
+    }
+    return 0;
+}
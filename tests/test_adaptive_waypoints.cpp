@@ -0,0 +1,77 @@
+#include "../include/Common.h"
+#include "../src/core/Logger.h"
+#include "../src/core/Map.h"
+#include "../src/algorithm/HybridAStarPSOAlgorithm.h"
+#include "TestSupport.h"
+#include <iostream>
+
+// 自适应航点数：由化简后引导路径的显著拐点数确定，限制在上下限之间；
+// 关闭时仍使用请求中的 numWaypoints；热启动重新规划沿用上一次的航点数
+
+// 蛇形地图：两道交错的墙，分别从上下边界伸出约三分之二的高度
+static void buildSerpentine(Map& map) {
+    buildOpenMap(map);
+    for (int wall = 1; wall <= 2; wall++) {
+        int x = wall * map.getWidth() / 3;
+        for (int y = 1; y < map.getHeight() - 1; y++) {
+            bool blocked = (wall % 2 == 1) ? y < map.getHeight() * 2 / 3 : y > map.getHeight() / 3;
+            if (blocked) {
+                map.setCell(x, y, 1);
+            }
+        }
+    }
+}
+
+static std::unique_ptr<HybridAStarPSOAlgorithm> createAlgorithm(bool adaptive) {
+    auto algorithm = createTestAlgorithm(60, 200, 40);
+    algorithm->setParameter("adaptiveWaypoints", adaptive ? 1 : 0);
+    return algorithm;
+}
+
+int main() {
+    Logger::instance().setLevel(LogLevel::Error);
+    int failures = 0;
+
+    Map open(40, 40, 1.0);
+    buildOpenMap(open);
+    Map serpentine(40, 40, 1.0);
+    buildSerpentine(serpentine);
+    const Point start(2.5, 2.5);
+    const Point end(37.5, 37.5);
+
+    // 空旷地图上的直线路线：取下限
+    auto algorithm = createAlgorithm(true);
+    PathPlanningResult simple = algorithm->planPath(makeRequest(open, start, end, 6, 5));
+    check("straight route uses the minimum", simple.success && simple.path.size() == 2 + 2, failures);
+
+    // 蛇形路线：拐点多，航点数随之增加，且不超过上限
+    PathPlanningResult complex = algorithm->planPath(makeRequest(serpentine, start, end, 6, 5));
+    std::cout << "  serpentine waypoints: " << complex.path.size() - 2 << std::endl;
+    check("winding route uses more waypoints",
+          complex.success && complex.path.size() > simple.path.size() && complex.path.size() <= 10 + 2, failures);
+
+    algorithm->setParameter("maxWaypoints", 4);
+    PathPlanningResult clamped = algorithm->planPath(makeRequest(serpentine, start, end, 6, 5));
+    check("upper bound", clamped.path.size() == 4 + 2 && algorithm->getParameter("maxWaypoints") == 4, failures);
+    algorithm->setParameter("maxWaypoints", 10);
+
+    // 关闭时使用请求中的航点数
+    PathPlanningResult fixed = createAlgorithm(false)->planPath(makeRequest(serpentine, start, end, 6, 5));
+    check("disabled keeps the requested count", fixed.path.size() == 6 + 2, failures);
+
+    // 热启动沿用上一次的航点数
+    const Point& a = complex.path[0];
+    const Point& b = complex.path[1];
+    double t = 1.0 / a.distanceTo(b);
+    Point moved(a.x + t * (b.x - a.x), a.y + t * (b.y - a.y));
+    PathPlanningResult warm = algorithm->replanPath(makeRequest(serpentine, moved, end, 6, 5), complex);
+    check("warm replan keeps the waypoint count",
+          warm.success && warm.path.size() == complex.path.size() && warm.iterations <= 50, failures);
+
+    if (failures != 0) {
+        std::cout << "Adaptive waypoint test FAILED" << std::endl;
+        return 1;
+    }
+    std::cout << "Adaptive waypoint test completed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "../src/algorithm/ZPSOAlgorithm.h"
+#include "TestSupport.h"
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// 异步模式共享全局最优的顺序锁：写者不断写入新的全局最优（位置各维相同、等于适应度），
+// 读者按工作线程的方式读入临时缓冲区、成功后才复制到副本，任何时刻副本都不得出现新旧混合的位置
+
+static bool isUniform(const std::vector<double>& position, double fitness) {
+    for (double value : position) {
+        if (value != fitness) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main() {
+    const int dimension = 64;
+    const int writes = 200000;
+    const int readerCount = 2;
+    ZPSO_AsyncBest<double> sharedBest(dimension);
+    std::vector<double> initial(dimension, 0.0);
+    sharedBest.tryImprove(0.0, initial.data());
+
+    std::atomic<bool> done(false);
+    std::atomic<long> mixedSnapshots(0);
+    std::atomic<long> mixedCopies(0);
+    std::atomic<long> consistentReads(0);
+    std::atomic<long> tornReads(0);
+
+    std::vector<std::thread> readers;
+    for (int r = 0; r < readerCount; r++) {
+        readers.emplace_back([&] {
+            std::vector<double> snapshot(dimension);
+            std::vector<double> globalBest(initial);
+            double globalBestFitness = 0.0;
+            while (!done.load(std::memory_order_relaxed)) {
+                double fitness;
+                if (sharedBest.tryRead(snapshot, fitness)) {
+                    if (!isUniform(snapshot, fitness)) {
+                        mixedSnapshots.fetch_add(1);
+                    }
+                    globalBest = snapshot;
+                    globalBestFitness = fitness;
+                    consistentReads.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    tornReads.fetch_add(1, std::memory_order_relaxed);
+                }
+                if (!isUniform(globalBest, globalBestFitness)) {
+                    mixedCopies.fetch_add(1);
+                }
+            }
+        });
+    }
+
+    std::vector<double> position(dimension);
+    for (int k = 1; k <= writes; k++) {
+        std::fill(position.begin(), position.end(), static_cast<double>(k));
+        sharedBest.tryImprove(k, position.data());
+        if (k % 64 == 0) {
+            std::this_thread::yield();  // 单核机器上也让读者与写者交错
+        }
+    }
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    std::vector<double> finalPosition(dimension);
+    double finalFitness = 0.0;
+    int failures = 0;
+    std::cout << "consistent reads: " << consistentReads.load() << ", torn reads: " << tornReads.load() << std::endl;
+    check("successful reads are never mixed", mixedSnapshots.load() == 0, failures);
+    check("worker copy is never mixed", mixedCopies.load() == 0, failures);
+    check("final snapshot", sharedBest.tryRead(finalPosition, finalFitness) && finalFitness == writes &&
+                            isUniform(finalPosition, finalFitness), failures);
+
+    if (failures != 0) {
+        std::cout << "Async best test FAILED" << std::endl;
+        return 1;
+    }
+    std::cout << "Async best test completed successfully!" << std::endl;
+    return 0;
+}
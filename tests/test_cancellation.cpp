@@ -0,0 +1,155 @@
+#include "../include/Common.h"
+#include "../src/core/Logger.h"
+#include "../src/core/Map.h"
+#include "../src/algorithm/HybridAStarPSOAlgorithm.h"
+#include "../src/algorithm/IslandPSOAlgorithm.h"
+#include "TestSupport.h"
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+
+// 取消令牌与进度回调：取消后尽快返回当前最优路径，终止原因为 cancelled；
+// 进度按 A* 扩展批次与每代进化报告；过大的时间预算不会溢出成已过期的截止时间
+
+// 不设时间预算、只依赖取消的长时间规划请求
+static PathPlanningRequest makeLongRequest(Map& map) {
+    PathPlanningRequest request = makeRequest(map, Point(3.5, 30.5), Point(56.5, 30.5), 5, 5);
+    request.maxTime = 0.0;
+    return request;
+}
+
+int main() {
+    Logger::instance().setLevel(LogLevel::Error);
+    Map map(60, 60, 1.0);
+    buildWallMap(map);
+    int failures = 0;
+
+    // 规划开始前已取消：A*在第一个检查点中止，PSO只评估初始种群
+    {
+        HybridAStarPSOAlgorithm algorithm;
+        configureTestAlgorithm(algorithm, 30, 200, 0);
+        CancellationToken token;
+        token.cancel();
+        PathPlanningRequest request = makeLongRequest(map);
+        request.cancellation = &token;
+        PathPlanningResult result = algorithm.planPath(request);
+        check("cancelled before start",
+              result.terminationReason == TerminationReason::Cancelled && result.iterations == 0 &&
+              result.stats.nodesExpanded == AStarAlgorithm::CHECKPOINT_INTERVAL &&
+              result.path.size() == static_cast<size_t>(request.numWaypoints) + 2, failures);
+    }
+
+    // 进度回调中在第10代取消：结果与只运行10代的规划逐位一致
+    {
+        HybridAStarPSOAlgorithm algorithm;
+        configureTestAlgorithm(algorithm, 30, 200, 0);
+        CancellationToken token;
+        int guideReports = 0;
+        int lastGeneration = 0;
+        bool ordered = true;
+        PathPlanningRequest request = makeLongRequest(map);
+        request.cancellation = &token;
+        request.progress = [&](const PlanningProgress& progress) {
+            if (progress.stage == PlanningStage::Guide) {
+                ordered = ordered && lastGeneration == 0;
+                guideReports++;
+                return;
+            }
+            ordered = ordered && progress.generation == lastGeneration + 1 && progress.maxGenerations == 200;
+            lastGeneration = progress.generation;
+            if (progress.generation == 10) {
+                token.cancel();
+            }
+        };
+        PathPlanningResult cancelled = algorithm.planPath(request);
+
+        HybridAStarPSOAlgorithm shortRun;
+        configureTestAlgorithm(shortRun, 30, 10, 0);
+        PathPlanningResult reference = shortRun.planPath(makeLongRequest(map));
+        check("progress reports", guideReports > 0 && ordered && lastGeneration == 10, failures);
+        check("cancel from progress callback returns best so far",
+              cancelled.terminationReason == TerminationReason::Cancelled && cancelled.iterations == 10 &&
+              cancelled.fitness == reference.fitness && cancelled.success == reference.success, failures);
+    }
+
+    // 从另一个线程取消一个很长的规划：应在取消后很快返回
+    {
+        HybridAStarPSOAlgorithm algorithm;
+        configureTestAlgorithm(algorithm, 30, 1000000, 0);
+        CancellationToken token;
+        PathPlanningRequest request = makeLongRequest(map);
+        request.cancellation = &token;
+        std::thread canceller([&token] {
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            token.cancel();
+        });
+        auto begin = std::chrono::steady_clock::now();
+        PathPlanningResult result = algorithm.planPath(request);
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+        canceller.join();
+        std::cout << "  cancelled after " << result.iterations << " generations, " << seconds << " s" << std::endl;
+        check("cancel from another thread",
+              result.terminationReason == TerminationReason::Cancelled && seconds < 5.0, failures);
+    }
+
+    // 异步模式按评估检查取消
+    {
+        HybridAStarPSOAlgorithm algorithm;
+        configureTestAlgorithm(algorithm, 30, 1000000, 0);
+        algorithm.setParameter("asyncMode", 1);
+        CancellationToken token;
+        PathPlanningRequest request = makeLongRequest(map);
+        request.cancellation = &token;
+        request.progress = [&token](const PlanningProgress& progress) {
+            if (progress.stage == PlanningStage::Guide && progress.nodesExpanded >= 2 * AStarAlgorithm::CHECKPOINT_INTERVAL) {
+                token.cancel();
+            }
+        };
+        PathPlanningResult result = algorithm.planPath(request);
+        check("async mode",
+              result.terminationReason == TerminationReason::Cancelled && result.iterations == 0, failures);
+    }
+
+    // 岛屿模型：0号岛屿报告进度，取消后全部岛屿停止
+    {
+        IslandPSOAlgorithm algorithm;
+        configureTestAlgorithm(algorithm, 30, 1000000, 0);
+        algorithm.setParameter("islandCount", 2);
+        CancellationToken token;
+        std::atomic<int> reports(0);
+        PathPlanningRequest request = makeLongRequest(map);
+        request.cancellation = &token;
+        request.progress = [&](const PlanningProgress& progress) {
+            if (progress.stage == PlanningStage::Optimize && reports.fetch_add(1) + 1 == 20) {
+                token.cancel();
+            }
+        };
+        PathPlanningResult result = algorithm.planPath(request);
+        check("island model",
+              result.terminationReason == TerminationReason::Cancelled && reports.load() >= 20 &&
+              result.path.size() == static_cast<size_t>(request.numWaypoints) + 2, failures);
+    }
+
+    // 超出时钟可表示范围的时间预算视为不设截止时间（换算不得溢出成已过期的截止时间）
+    {
+        HybridAStarPSOAlgorithm algorithm;
+        configureTestAlgorithm(algorithm, 30, 10, 0);
+        bool unbounded = true;
+        for (double maxTime : {1e10, 1e300, HUGE_VAL}) {
+            PathPlanningRequest request = makeLongRequest(map);
+            request.maxTime = maxTime;
+            PathPlanningResult result = algorithm.planPath(request);
+            unbounded = unbounded && result.terminationReason == TerminationReason::Completed &&
+                        result.iterations == 10;
+        }
+        check("huge time budget means no deadline", unbounded, failures);
+    }
+
+    if (failures != 0) {
+        std::cout << "Cancellation test FAILED" << std::endl;
+        return 1;
+    }
+    std::cout << "Cancellation test completed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,127 @@
+#include "../include/Common.h"
+#include "../src/core/Logger.h"
+#include "../src/core/Map.h"
+#include "../src/algorithm/HybridAStarPSOAlgorithm.h"
+#include "../src/algorithm/IslandPSOAlgorithm.h"
+#include <iostream>
+#include <thread>
+
+// 同一个算法实例被多个线程同时调用 planPath：每个请求的结果必须与串行规划逐位一致，
+// 且一次规划的状态（如A*失败时关闭偏离惩罚）不能影响其他规划。
+// 应在 -fsanitize=thread 下无数据竞争报告。
+
+constexpr int THREADS = 4;
+constexpr int ROUNDS = 2;
+
+static bool samePath(const PathPlanningResult& a, const PathPlanningResult& b) {
+    if (a.fitness != b.fitness || a.path.size() != b.path.size() || a.success != b.success) {
+        return false;
+    }
+    for (size_t i = 0; i < a.path.size(); i++) {
+        if (a.path[i].x != b.path[i].x || a.path[i].y != b.path[i].y) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void configure(IPathPlanningAlgorithm& algorithm, int threadCount) {
+    algorithm.setParameter("particleCount", 40);
+    algorithm.setParameter("generations", 60);
+    algorithm.setParameter("maxSpeed", 4.0);
+    algorithm.setParameter("corridorMargin", 3.0);
+    algorithm.setParameter("threadCount", threadCount);
+}
+
+static std::vector<PathPlanningRequest> buildRequests(Map& map) {
+    const Point endpoints[][2] = {
+        {Point(2.0, 2.0), Point(17.0, 17.0)}, {Point(17.0, 2.0), Point(2.0, 17.0)},
+        {Point(2.5, 10.0), Point(17.5, 10.0)}, {Point(10.0, 2.5), Point(10.0, 17.5)},
+        {Point(2.0, 2.0), Point(0.5, 10.5)},  // 终点在边界障碍上：A*失败，本次规划不使用偏离惩罚
+        {Point(3.0, 16.0), Point(16.0, 3.0)}
+    };
+    std::vector<PathPlanningRequest> requests;
+    for (size_t i = 0; i < sizeof(endpoints) / sizeof(endpoints[0]); i++) {
+        PathPlanningRequest request;
+        request.startPoint = endpoints[i][0];
+        request.endPoint = endpoints[i][1];
+        request.map = &map;
+        request.numWaypoints = 5;
+        request.randomSeed = 11 + i;
+        requests.push_back(request);
+    }
+    return requests;
+}
+
+// 多个线程以不同顺序反复规划全部请求，返回与参考结果不一致的次数
+static int runConcurrently(IPathPlanningAlgorithm& algorithm, const std::vector<PathPlanningRequest>& requests,
+                           const std::vector<PathPlanningResult>* reference) {
+    std::atomic<int> mismatches(0);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; t++) {
+        threads.emplace_back([&, t] {
+            for (int round = 0; round < ROUNDS; round++) {
+                for (size_t k = 0; k < requests.size(); k++) {
+                    size_t index = (k + t * 2 + round) % requests.size();
+                    PathPlanningResult result = algorithm.planPath(requests[index]);
+                    bool ok = reference ? samePath(result, (*reference)[index])
+                                        : result.path.size() == static_cast<size_t>(requests[index].numWaypoints) + 2;
+                    if (!ok) {
+                        mismatches.fetch_add(1);
+                    }
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    return mismatches.load();
+}
+
+int main() {
+    Logger::instance().setLevel(LogLevel::Error);
+    Map map;
+    std::vector<PathPlanningRequest> requests = buildRequests(map);
+    int failures = 0;
+
+    // 单线程评估与共享线程池评估（并发规划争用线程池时退回串行，结果不变）
+    for (int threadCount : {1, 2}) {
+        HybridAStarPSOAlgorithm algorithm;
+        configure(algorithm, threadCount);
+        std::vector<PathPlanningResult> reference;
+        for (const PathPlanningRequest& request : requests) {
+            HybridAStarPSOAlgorithm fresh;
+            configure(fresh, 1);
+            reference.push_back(fresh.planPath(request));
+        }
+
+        int mismatches = runConcurrently(algorithm, requests, &reference);
+        bool configIntact = algorithm.getParameter("deviationWeight") == 5.0;
+        std::cout << "hybrid, evaluation threads " << threadCount << ": " << mismatches << " mismatches in "
+                  << THREADS * ROUNDS * requests.size() << " concurrent plans"
+                  << (configIntact ? "" : ", configuration modified") << std::endl;
+        if (mismatches != 0 || !configIntact) {
+            failures++;
+        }
+    }
+
+    // 岛屿模型：迁移时机依赖调度，只检查并发调用能正常完成
+    {
+        IslandPSOAlgorithm algorithm;
+        configure(algorithm, 1);
+        algorithm.setParameter("islandCount", 2);
+        int mismatches = runConcurrently(algorithm, requests, nullptr);
+        std::cout << "island, 2 islands: " << mismatches << " malformed results" << std::endl;
+        if (mismatches != 0) {
+            failures++;
+        }
+    }
+
+    if (failures != 0) {
+        std::cout << "Concurrent planning test FAILED" << std::endl;
+        return 1;
+    }
+    std::cout << "Concurrent planning test completed successfully!" << std::endl;
+    return 0;
+}
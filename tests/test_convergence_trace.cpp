@@ -0,0 +1,62 @@
+#include "../src/algorithm/ConvergenceTrace.h"
+#include "../src/algorithm/ZPSOAlgorithm.h"
+#include <iostream>
+#include <sstream>
+
+// 环形缓冲区写满后保留最近 capacity 条记录，挂接到粒子群后每代记录一次
+int main() {
+    int failures = 0;
+
+    ConvergenceTrace ring(4);
+    for (int g = 0; g < 10; g++) {
+        ring.record(g, g * 1.0, 0.0, 0.0);
+    }
+    bool ordered = ring.size() == 4 && ring.dropped() == 6;
+    for (size_t i = 0; ordered && i < ring.size(); i++) {
+        ordered = ring[i].generation == static_cast<int>(6 + i) &&
+                  (i == 0 || ring[i].elapsedNs >= ring[i - 1].elapsedNs);
+    }
+    std::cout << "ring buffer wraparound: " << (ordered ? "OK" : "FAILED") << std::endl;
+    if (!ordered) {
+        failures++;
+    }
+
+    double minBounds[4] = {-5.0, -5.0, -5.0, -5.0};
+    double maxBounds[4] = {5.0, 5.0, 5.0, 5.0};
+    ZPSO_Algorithm swarm([](ZPSO_Partical& p) {
+        double sum = 0.0;
+        for (int j = 0; j < p.getDimension(); j++) {
+            sum += p._position[j] * p._position[j];
+        }
+        return -sum;
+    }, minBounds, maxBounds, 4, 20, 2.0, 2.0, 1.0, 3);
+    ConvergenceTrace trace(64);
+    swarm.setTrace(&trace);
+    ZPSO_Partical best(4);
+    swarm.findMax(30, best);
+
+    // 初始种群 + 30 代，全局最优单调不减且最后一条等于返回的最优解
+    bool recorded = trace.size() == 31 && trace[0].generation == 0 && trace[30].generation == 30 &&
+                    trace[30].bestFitness == best._bestFitness;
+    for (size_t i = 1; recorded && i < trace.size(); i++) {
+        recorded = trace[i].bestFitness >= trace[i - 1].bestFitness && trace[i].swarmDiameter >= 0.0;
+    }
+    std::ostringstream csv;
+    trace.writeCsv(csv);
+    size_t lines = 0;
+    for (char c : csv.str()) {
+        lines += c == '\n' ? 1 : 0;
+    }
+    recorded = recorded && lines == trace.size() + 1;
+    std::cout << "swarm trace: " << trace.size() << " records " << (recorded ? "OK" : "FAILED") << std::endl;
+    if (!recorded) {
+        failures++;
+    }
+
+    if (failures != 0) {
+        std::cout << "Convergence trace test FAILED" << std::endl;
+        return 1;
+    }
+    std::cout << "Convergence trace test completed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,92 @@
+#include "../include/Common.h"
+#include "../src/algorithm/GuideDistanceField.h"
+#include "../src/algorithm/ZPSOAlgorithm.h"
+#include <iostream>
+
+// 距离场插值结果与逐段精确计算之差不得超过文档给出的误差上界 h/√2；多区域距离场只覆盖区域并集
+int main() {
+    // 一条类似A*输出的折线（含对角与直角拐弯）
+    std::vector<Point> guide = {
+        Point(1.5, 1.5), Point(2.5, 2.5), Point(3.5, 3.5), Point(3.5, 4.5), Point(3.5, 5.5),
+        Point(4.5, 6.5), Point(5.5, 6.5), Point(9.5, 6.5), Point(10.5, 7.5), Point(17.5, 17.5)
+    };
+
+    ZPSO_Random random(42);
+    int failures = 0;
+    const double resolutions[] = {1.0, 0.5, 0.25};
+    for (double h : resolutions) {
+        GuideDistanceField field;
+        field.build(guide, 0.0, 0.0, 20.0, 20.0, h);
+
+        double maxError = 0.0;
+        for (int k = 0; k < 20000; k++) {
+            Point p(random.rand0_1() * 20.0, random.rand0_1() * 20.0);
+            double interpolated;
+            if (!field.lookup(p, interpolated)) {
+                std::cout << "lookup missed inside field at (" << p.x << ", " << p.y << ")" << std::endl;
+                failures++;
+                continue;
+            }
+            maxError = std::max(maxError, std::fabs(interpolated - GuideDistanceField::exactDistance(guide, p)));
+        }
+        bool ok = maxError <= field.tolerance() + 1e-12;
+        std::cout << "h = " << h << ": max error " << maxError << " (tolerance " << field.tolerance() << ") "
+                  << (ok ? "OK" : "EXCEEDED") << std::endl;
+        if (!ok) {
+            failures++;
+        }
+
+        // 区域外的点必须返回未命中，由调用者退回精确计算
+        double unused;
+        if (field.lookup(Point(-0.1, 5.0), unused) || field.lookup(Point(5.0, 20.1), unused)) {
+            std::cout << "lookup outside field did not miss" << std::endl;
+            failures++;
+        }
+    }
+
+    // 多个区域的并集：区域内（含重叠部分）满足误差上界，区域之间的空隙未计算、查询未命中
+    {
+        const double h = 0.25;
+        std::vector<GuideDistanceField::Region> regions = {
+            {0.0, 0.0, 6.3, 7.1}, {4.2, 5.0, 11.7, 9.9}, {13.0, 13.0, 20.0, 20.0}
+        };
+        GuideDistanceField field;
+        field.build(guide, regions, h);
+
+        double maxError = 0.0;
+        for (int k = 0; k < 20000; k++) {
+            const GuideDistanceField::Region& region = regions[k % regions.size()];
+            Point p(region.minX + random.rand0_1() * (region.maxX - region.minX),
+                    region.minY + random.rand0_1() * (region.maxY - region.minY));
+            double interpolated;
+            if (!field.lookup(p, interpolated)) {
+                std::cout << "lookup missed inside region at (" << p.x << ", " << p.y << ")" << std::endl;
+                failures++;
+                continue;
+            }
+            maxError = std::max(maxError, std::fabs(interpolated - GuideDistanceField::exactDistance(guide, p)));
+        }
+        double unused;
+        bool gapMissed = !field.lookup(Point(16.0, 3.0), unused) && !field.lookup(Point(2.0, 16.0), unused);
+        bool ok = maxError <= field.tolerance() + 1e-12 && gapMissed;
+        std::cout << "regions: max error " << maxError << ", gap " << (gapMissed ? "missed" : "HIT") << " "
+                  << (ok ? "OK" : "FAILED") << std::endl;
+        if (!ok) {
+            failures++;
+        }
+
+        GuideDistanceField empty;
+        empty.build(guide, std::vector<GuideDistanceField::Region>(), h);
+        if (empty.lookup(Point(5.0, 5.0), unused)) {
+            std::cout << "empty field did not miss" << std::endl;
+            failures++;
+        }
+    }
+
+    if (failures != 0) {
+        std::cout << "Guide distance field test FAILED" << std::endl;
+        return 1;
+    }
+    std::cout << "Guide distance field test completed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,96 @@
+#include "../src/core/Logger.h"
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+// 多个线程并发写日志：写出的每条消息完整且恰好出现一次，写出数与丢弃数之和等于写入总数
+int main() {
+    constexpr int THREADS = 4;
+    constexpr int MESSAGES = 5000;
+    int failures = 0;
+
+    std::FILE* file = std::tmpfile();
+    if (!file) {
+        std::cout << "Logger test FAILED: cannot create temporary file" << std::endl;
+        return 1;
+    }
+
+    uint64_t dropped = 0;
+    {
+        Logger logger(256, file);
+        logger.setLevel(LogLevel::Debug);
+        std::vector<std::thread> producers;
+        for (int t = 0; t < THREADS; t++) {
+            producers.emplace_back([&logger, t] {
+                char text[64];
+                for (int i = 0; i < MESSAGES; i++) {
+                    int length = std::snprintf(text, sizeof(text), "thread %d message %d", t, i);
+                    logger.log(LogLevel::Info, text, static_cast<size_t>(length));
+                }
+            });
+        }
+        for (std::thread& producer : producers) {
+            producer.join();
+        }
+        logger.flush();
+        logger.log(LogLevel::Trace, "below level", 11);  // log 本身不过滤级别，过滤在宏中完成
+        logger.flush();
+        dropped = logger.dropped();
+    }
+
+    // 逐行校验：格式完整，且每个线程内的消息按写入顺序出现、没有重复
+    std::rewind(file);
+    std::vector<int> lastSeen(THREADS, -1);
+    uint64_t lines = 0;
+    bool wellFormed = true;
+    char line[Logger::MESSAGE_SIZE + 16];
+    while (std::fgets(line, sizeof(line), file)) {
+        int t, i;
+        if (std::sscanf(line, "[INFO] thread %d message %d", &t, &i) == 2) {
+            if (t < 0 || t >= THREADS || i <= lastSeen[t]) {
+                wellFormed = false;
+            } else {
+                lastSeen[t] = i;
+            }
+            lines++;
+        } else if (std::strcmp(line, "[TRACE] below level\n") != 0) {
+            wellFormed = false;
+        }
+    }
+    std::fclose(file);
+
+    bool accounted = lines + dropped == static_cast<uint64_t>(THREADS) * MESSAGES;
+    std::cout << "concurrent producers: " << lines << " written, " << dropped << " dropped "
+              << (wellFormed && accounted ? "OK" : "FAILED") << std::endl;
+    if (!wellFormed || !accounted) {
+        failures++;
+    }
+
+    // 宏按运行期级别过滤，被过滤时不对参数求值
+    Logger::instance().setLevel(LogLevel::Error);
+    int evaluated = 0;
+    LOG_WARN("filtered " << ++evaluated);
+    bool filtered = evaluated == 0;
+    std::cout << "runtime level filter: " << (filtered ? "OK" : "FAILED") << std::endl;
+    if (!filtered) {
+        failures++;
+    }
+
+    LogLevel level;
+    bool parsed = Logger::parseLevel("warn", level) && level == LogLevel::Warn &&
+                  Logger::parseLevel("OFF", level) && level == LogLevel::Off &&
+                  !Logger::parseLevel("verbose", level);
+    std::cout << "level names: " << (parsed ? "OK" : "FAILED") << std::endl;
+    if (!parsed) {
+        failures++;
+    }
+
+    if (failures != 0) {
+        std::cout << "Logger test FAILED" << std::endl;
+        return 1;
+    }
+    std::cout << "Logger test completed successfully!" << std::endl;
+    return 0;
+}
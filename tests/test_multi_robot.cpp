@@ -0,0 +1,128 @@
+#include "../include/Common.h"
+#include "../src/core/Map.h"
+#include "../src/algorithm/CooperativeAStarPlanner.h"
+#include "../src/algorithm/ZPSOAlgorithm.h"
+#include "TestSupport.h"
+#include <iostream>
+
+// 多机器人时空规划：预约表的基本语义；优先级规划与CBS的结果没有顶点/边冲突，
+// CBS 的总代价不高于优先级规划，且不低于各机器人单独最短路之和
+
+static Point center(int x, int y) {
+    return Point(x + 0.5, y + 0.5);
+}
+
+// 随机取 count 组互不相同的起点与终点
+static std::vector<MultiAgentTask> randomTasks(const Map& map, int count, uint64_t seed) {
+    ZPSO_Random random(seed);
+    std::vector<char> usedStart(map.getWidth() * map.getHeight(), 0);
+    std::vector<char> usedGoal(usedStart.size(), 0);
+    std::vector<MultiAgentTask> tasks;
+    auto pick = [&](std::vector<char>& used) {
+        for (;;) {
+            int x = static_cast<int>(random.rand0_1() * map.getWidth());
+            int y = static_cast<int>(random.rand0_1() * map.getHeight());
+            if (map.getCell(x, y) == 0 && !used[y * map.getWidth() + x]) {
+                used[y * map.getWidth() + x] = 1;
+                return center(x, y);
+            }
+        }
+    };
+    for (int i = 0; i < count; i++) {
+        Point start = pick(usedStart);
+        tasks.emplace_back(start, pick(usedGoal));
+    }
+    return tasks;
+}
+
+int main() {
+    int failures = 0;
+
+    // 预约表：占用、停靠与扩容
+    {
+        ReservationTable table(16);
+        table.reset(100);
+        bool ok = table.reserve(5, 3, 1) && table.reserve(5, 3, 1) && !table.reserve(5, 3, 2) &&
+                  table.owner(5, 3) == 1 && table.owner(5, 4) == ReservationTable::NONE && table.lastReserved(5) == 3;
+        table.park(7, 10, 2);
+        ok = ok && table.owner(7, 9) == ReservationTable::NONE && table.owner(7, 10) == 2 && table.owner(7, 1000) == 2;
+        for (int step = 0; step < 5000; step++) {
+            table.reserve(step % 100, step, step % 7);
+        }
+        bool grown = table.capacity() >= 2 * table.size();
+        for (int step = 0; step < 5000 && grown; step++) {
+            int cell = step % 100;
+            if (cell != 7 || step < 10) {
+                grown = table.owner(cell, step) == (cell == 5 && step == 3 ? 1 : step % 7);
+            }
+        }
+        check("reservation table", ok && grown, failures);
+    }
+
+    // 走廊对换：中间有一个侧袋可供让行。先规划的机器人直行到终点，
+    // 后规划的机器人来不及躲进侧袋，优先级规划只能解出一个；CBS 让先行者等待，总代价 5 + 6
+    {
+        Map map(20, 20, 1.0);
+        for (int y = 0; y < map.getHeight(); y++) {
+            for (int x = 0; x < map.getWidth(); x++) {
+                bool open = (y == 1 && x >= 1 && x <= 5) || (y == 2 && x == 3);
+                map.setCell(x, y, open ? 0 : 1);
+            }
+        }
+        std::vector<MultiAgentTask> tasks = {{center(1, 1), center(5, 1)}, {center(5, 1), center(1, 1)}};
+        CooperativeAStarPlanner planner;
+        CooperativeAStarPlanner::Conflict conflict;
+        MultiAgentResult prioritized = planner.plan(map, tasks);
+        check("corridor swap, prioritized",
+              !prioritized.success && prioritized.solvedAgents == 1 && prioritized.paths[1].empty() &&
+              !planner.findConflict(map, prioritized, conflict), failures);
+        planner.setMode(MultiAgentMode::ConflictBasedSearch);
+        MultiAgentResult cbs = planner.plan(map, tasks);
+        std::cout << "  CBS sum of costs " << cbs.sumOfCosts << ", makespan " << cbs.makespan
+                  << " (" << cbs.highLevelNodes << " high-level nodes)" << std::endl;
+        check("corridor swap, CBS",
+              cbs.success && !planner.findConflict(map, cbs, conflict) && cbs.sumOfCosts == 11 && cbs.makespan == 6,
+              failures);
+    }
+
+    // 默认地图上的随机任务
+    {
+        Map map;
+        std::vector<MultiAgentTask> tasks = randomTasks(map, 30, 17);
+        CooperativeAStarPlanner planner;
+        CooperativeAStarPlanner::Conflict conflict;
+        MultiAgentResult prioritized = planner.plan(map, tasks);
+        check("30 agents, prioritized",
+              prioritized.success && !planner.findConflict(map, prioritized, conflict), failures);
+
+        std::vector<MultiAgentTask> few(tasks.begin(), tasks.begin() + 8);
+        MultiAgentResult fewPrioritized = planner.plan(map, few);
+        long lowerBound = 0;
+        for (const MultiAgentTask& task : few) {
+            MultiAgentResult single = planner.plan(map, {task});
+            lowerBound += single.sumOfCosts;
+        }
+        planner.setMode(MultiAgentMode::ConflictBasedSearch);
+        MultiAgentResult cbs = planner.plan(map, few);
+        std::cout << "  8 agents sum of costs: lower bound " << lowerBound << ", prioritized "
+                  << fewPrioritized.sumOfCosts << ", CBS " << cbs.sumOfCosts << std::endl;
+        check("8 agents, CBS",
+              cbs.success && !planner.findConflict(map, cbs, conflict) &&
+              cbs.sumOfCosts <= fewPrioritized.sumOfCosts && cbs.sumOfCosts >= lowerBound, failures);
+    }
+
+    // 起点在障碍物上：整体失败
+    {
+        Map map;
+        CooperativeAStarPlanner planner;
+        MultiAgentResult result = planner.plan(map, {{center(0, 0), center(5, 5)}});
+        check("invalid task", !result.success && result.solvedAgents == 0, failures);
+    }
+
+    if (failures != 0) {
+        std::cout << "Multi-robot planning test FAILED" << std::endl;
+        return 1;
+    }
+    std::cout << "Multi-robot planning test completed successfully!" << std::endl;
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include "../include/Common.h"
+#include "../src/core/Logger.h"
+#include "../src/core/Map.h"
+#include "../src/core/PathPlanner.h"
+#include "../src/core/PathPostProcessor.h"
+#include "../src/algorithm/HybridAStarPSOAlgorithm.h"
+#include "TestSupport.h"
+#include <iostream>
+
+// 路径后处理：视线捷径去掉阶梯与冗余航点，样条平滑按固定弧长采样且不产生碰撞，
+// PathPlanner 开启后处理后仍以原始结果热启动重新规划
+
+static bool isColliding(const Map& map, const std::vector<Point>& path) {
+    for (size_t i = 1; i < path.size(); i++) {
+        if (map.isLineColliding(path[i-1], path[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static double pathLength(const std::vector<Point>& path) {
+    double length = 0.0;
+    for (size_t i = 1; i < path.size(); i++) {
+        length += path[i-1].distanceTo(path[i]);
+    }
+    return length;
+}
+
+int main() {
+    Logger::instance().setLevel(LogLevel::Error);
+    Map map(40, 40, 1.0);
+    buildWallMap(map);
+    int failures = 0;
+
+    // 空旷区域的网格阶梯：捷径后只剩首末点
+    {
+        std::vector<Point> staircase;
+        for (int i = 0; i < 10; i++) {
+            staircase.emplace_back(2.5 + i, 2.5 + i);
+            staircase.emplace_back(3.5 + i, 2.5 + i);
+        }
+        PathPostProcessor processor;
+        PostProcessingStats stats;
+        std::vector<Point> result = processor.process(map, staircase, &stats);
+        check("staircase shortcut", result.size() == 2 && result.front().distanceTo(staircase.front()) < 1e-12 &&
+                                    result.back().distanceTo(staircase.back()) < 1e-12 &&
+                                    stats.segmentChecks == staircase.size() - 2, failures);
+    }
+
+    // 绕墙的路径：捷径保留缺口附近的拐点，不穿墙
+    std::vector<Point> detour = {Point(5.5, 30.5), Point(10.5, 20.5), Point(15.5, 8.5), Point(19.0, 2.5),
+                                 Point(21.0, 2.5), Point(25.5, 8.5), Point(30.5, 20.5), Point(34.5, 30.5)};
+    PostProcessingOptions options;
+    {
+        PathPostProcessor processor(options);
+        std::vector<Point> result = processor.process(map, detour);
+        check("detour shortcut", result.size() >= 3 && result.size() < detour.size() &&
+                                 !isColliding(map, result) && pathLength(result) < pathLength(detour), failures);
+    }
+
+    // 样条平滑：首末点不变，相邻采样点间距不超过设定值，无碰撞
+    {
+        options.smoothing = true;
+        options.sampleSpacing = 0.25;
+        options.maxCurvature = 2.0;
+        PathPostProcessor processor(options);
+        PostProcessingStats stats;
+        std::vector<Point> result = processor.process(map, detour, &stats);
+        double maxGap = 0.0;
+        for (size_t i = 1; i < result.size(); i++) {
+            maxGap = std::max(maxGap, result[i-1].distanceTo(result[i]));
+        }
+        std::cout << "  " << stats.inputPoints << " -> " << stats.shortcutPoints << " waypoints -> "
+                  << stats.outputPoints << " samples, relaxed spans " << stats.relaxedSpans
+                  << ", straight spans " << stats.straightSpans << std::endl;
+        check("spline smoothing", result.front().distanceTo(detour.front()) < 1e-12 &&
+                                  result.back().distanceTo(detour.back()) < 1e-12 &&
+                                  maxGap <= options.sampleSpacing + 1e-9 && !isColliding(map, result), failures);
+
+        // 曲率上限极小时全部退化为直线段：采样点都落在捷径折线上，长度与捷径一致
+        options.maxCurvature = 1e-6;
+        PathPostProcessor straight(options);
+        std::vector<Point> flat = straight.process(map, detour, &stats);
+        options.smoothing = false;
+        std::vector<Point> shortcut = PathPostProcessor(options).process(map, detour);
+        check("curvature bound falls back to straight spans",
+              stats.straightSpans == static_cast<int>(stats.shortcutPoints) - 1 &&
+              std::fabs(pathLength(flat) - pathLength(shortcut)) < 1e-9, failures);
+    }
+
+    // PathPlanner：后处理不改变适应度，重新规划仍以原始结果热启动
+    {
+        const Point start(3.5, 20.5);
+        const Point end(36.5, 20.5);
+        PathPlanner raw(&map, start, end, createTestAlgorithm());
+        PathPlanningResult rawResult = raw.planPath();
+
+        PathPlanner planner(&map, start, end, createTestAlgorithm());
+        planner.setPostProcessing(true);
+        PathPlanningResult result = planner.planPath();
+        check("planner post-processing",
+              result.success && result.fitness == rawResult.fitness && !isColliding(map, result.path) &&
+              result.pathLength <= rawResult.pathLength + 1e-9 && result.stats.postProcessNs > 0 &&
+              planner.getBestPath().size() == result.path.size(), failures);
+
+        PostProcessingOptions smoothOptions;
+        smoothOptions.smoothing = true;
+        planner.setPostProcessing(true, smoothOptions);
+        PathPlanningResult replanned = planner.replan(Point(4.5, 20.5));
+        check("planner replans from the raw result",
+              replanned.success && replanned.iterations <= 50 && replanned.path.size() > rawResult.path.size() &&
+              !isColliding(map, replanned.path), failures);
+    }
+
+    if (failures != 0) {
+        std::cout << "Path post-processing test FAILED" << std::endl;
+        return 1;
+    }
+    std::cout << "Path post-processing test completed successfully!" << std::endl;
+    return 0;
+}
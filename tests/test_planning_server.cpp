@@ -0,0 +1,264 @@
+#include "../include/Common.h"
+#include "../src/core/Logger.h"
+#include "../src/core/Map.h"
+#include "../src/core/PlanningServer.h"
+#include "TestSupport.h"
+#include "../src/algorithm/HybridAStarPSOAlgorithm.h"
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <thread>
+
+#ifndef _WIN32
+#include "../src/tools/UnixSocket.h"
+#endif
+
+// 常驻规划服务：协议的解析与格式化、标准输入输出模式下多工作线程并发处理流水线请求
+// （结果与直接调用算法一致，每个 id 恰好回复一次）、Unix 域套接字模式
+
+static std::unique_ptr<IPathPlanningAlgorithm> createAlgorithm() {
+    return createTestAlgorithm(40, 100, 30);
+}
+
+// 默认地图上的若干起终点对（均为可通行网格中心）
+static std::vector<PlanningProtocol::Request> makeRequests(const Map& map, int count) {
+    std::vector<Point> freeCells;
+    for (int y = 1; y < map.getHeight() - 1; y += 3) {
+        for (int x = 1; x < map.getWidth() - 1; x += 3) {
+            if (map.getCell(x, y) == 0) {
+                freeCells.emplace_back(x + 0.5, y + 0.5);
+            }
+        }
+    }
+    std::vector<PlanningProtocol::Request> requests;
+    for (int i = 0; i < count; i++) {
+        PlanningProtocol::Request request;
+        request.id = std::to_string(100 + i);
+        request.start = freeCells[i % freeCells.size()];
+        request.goal = freeCells[(i * 7 + freeCells.size() / 2) % freeCells.size()];
+        request.hasSeed = true;
+        request.seed = 1 + i;
+        request.waypoints = 3 + i % 3;
+        requests.push_back(request);
+    }
+    return requests;
+}
+
+int main() {
+    Logger::instance().setLevel(LogLevel::Error);
+    int failures = 0;
+
+    // 协议：字段解析、字符串 id 原样回显、未知字段忽略、缺少必填字段与格式错误
+    {
+        PlanningProtocol::Request request;
+        std::string error;
+        bool parsed = PlanningProtocol::parseRequest(
+            " {\"id\": \"r-1\", \"start\": [2.5, 3], \"goal\":[17,17.25], \"seed\": 9, \"waypoints\": 4,"
+            " \"extra\": {\"nested\": [1, {\"x\": null}], \"flag\": true}, \"maxTime\": 2.5} ", request, error);
+        check("parse request", parsed && request.id == "\"r-1\"" && request.start.x == 2.5 && request.start.y == 3 &&
+                               request.goal.y == 17.25 && request.hasSeed && request.seed == 9 &&
+                               request.waypoints == 4 && request.maxTime == 2.5, failures);
+
+        PlanningProtocol::Request roundTrip;
+        check("request round trip", PlanningProtocol::parseRequest(PlanningProtocol::formatRequest(request), roundTrip,
+                                                                   error) &&
+                                    roundTrip.id == request.id && roundTrip.goal.x == request.goal.x &&
+                                    roundTrip.seed == request.seed && roundTrip.waypoints == request.waypoints, failures);
+
+        bool missing = PlanningProtocol::parseRequest("{\"id\":3,\"start\":[1,1]}", request, error);
+        check("missing goal rejected", !missing && request.id == "3" && !error.empty(), failures);
+        bool malformed = PlanningProtocol::parseRequest("{\"id\":4,\"start\":[1,1],\"goal\":[2,2]", request, error);
+        bool trailing = PlanningProtocol::parseRequest("{\"id\":5,\"start\":[1,1],\"goal\":[2,2]} x", request, error);
+        check("malformed rejected", !malformed && !trailing, failures);
+
+        // 数字只接受 JSON 语法；waypoints 与 seed 先检查整数与范围再转换，maxTime 检查范围
+        const char* badNumbers[] = {
+            "[nan, 1]", "[inf, 1]", "[-Infinity, 1]", "[0x10, 1]", "[1e999, 1]", "[.5, 1]", "[01, 1]", "[1., 1]", "[+1, 1]"
+        };
+        bool numbersRejected = true;
+        for (const char* point : badNumbers) {
+            numbersRejected = numbersRejected &&
+                              !PlanningProtocol::parseRequest(std::string("{\"start\":") + point + ",\"goal\":[2,2]}",
+                                                              request, error);
+        }
+        check("non-JSON numbers rejected", numbersRejected, failures);
+
+        const std::string prefix = "{\"id\":6,\"start\":[1,1],\"goal\":[2,2],";
+        std::string waypointError;
+        PlanningProtocol::parseRequest(prefix + "\"waypoints\":0}", request, waypointError);
+        bool waypointsRejected = !waypointError.empty();
+        const char* badWaypoints[] = {"-1", "-3", "65", "2.5", "4294967297", "1e300"};
+        for (const char* waypoints : badWaypoints) {
+            waypointsRejected = waypointsRejected &&
+                                !PlanningProtocol::parseRequest(prefix + "\"waypoints\":" + waypoints + "}", request,
+                                                                error) &&
+                                error == waypointError;
+        }
+        bool waypointsAccepted = PlanningProtocol::parseRequest(prefix + "\"waypoints\":64}", request, error) &&
+                                 request.waypoints == 64 &&
+                                 PlanningProtocol::parseRequest(prefix + "\"waypoints\":1e1}", request, error) &&
+                                 request.waypoints == 10;
+        check("waypoints range", waypointsRejected && waypointsAccepted, failures);
+
+        const char* badSeeds[] = {"-1", "1.5", "18446744073709551616", "1.8446744073709552e19", "-0.5"};
+        bool seedsRejected = true;
+        for (const char* seed : badSeeds) {
+            seedsRejected = seedsRejected &&
+                            !PlanningProtocol::parseRequest(prefix + "\"seed\":" + seed + "}", request, error);
+        }
+        bool seedsAccepted = PlanningProtocol::parseRequest(prefix + "\"seed\":18446744073709551615}", request, error) &&
+                             request.seed == UINT64_MAX &&
+                             PlanningProtocol::parseRequest(prefix + "\"seed\":2e3}", request, error) &&
+                             request.seed == 2000 && request.hasSeed;
+        check("seed range", seedsRejected && seedsAccepted, failures);
+
+        const char* badMaxTimes[] = {"0", "-1", "-0.5", "3600.5", "1e10", "1e300"};
+        bool maxTimesRejected = true;
+        for (const char* maxTime : badMaxTimes) {
+            maxTimesRejected = maxTimesRejected &&
+                               !PlanningProtocol::parseRequest(prefix + "\"maxTime\":" + maxTime + "}", request, error) &&
+                               error.find("maxTime") != std::string::npos;
+        }
+        bool maxTimesAccepted = PlanningProtocol::parseRequest(prefix + "\"maxTime\":0.25}", request, error) &&
+                                request.maxTime == 0.25 &&
+                                PlanningProtocol::parseRequest(prefix + "\"maxTime\":3600}", request, error) &&
+                                request.maxTime == 3600.0;
+        check("maxTime range", maxTimesRejected && maxTimesAccepted, failures);
+
+        PathPlanningResult result({Point(2, 2), Point(5.125, 7.5), Point(17, 17)}, 22.5, 1003.25, true);
+        result.iterations = 42;
+        result.terminationReason = TerminationReason::Stalled;
+        PlanningProtocol::Response response;
+        check("response round trip",
+              PlanningProtocol::parseResponse(PlanningProtocol::formatResult("\"r-1\"", result, 1.5, 2), response) &&
+              response.id == "\"r-1\"" && response.success && response.fitness == 1003.25 &&
+              response.iterations == 42 && response.reason == "stalled" && response.worker == 2 &&
+              response.path.size() == 3 && response.path[1].x == 5.125 && response.path[1].y == 7.5, failures);
+    }
+
+    Map map(20, 20, 1.0);
+    std::vector<PlanningProtocol::Request> requests = makeRequests(map, 12);
+
+    // 直接调用算法得到的参照结果
+    std::map<std::string, double> expectedFitness;
+    {
+        auto algorithm = createAlgorithm();
+        for (const auto& request : requests) {
+            PathPlanningRequest planRequest;
+            planRequest.startPoint = request.start;
+            planRequest.endPoint = request.goal;
+            planRequest.map = &map;
+            planRequest.numWaypoints = request.waypoints;
+            planRequest.randomSeed = request.seed;
+            expectedFitness[request.id] = algorithm->planPath(planRequest).fitness;
+        }
+    }
+
+    // 标准输入输出模式：全部请求一次写入（流水线），3 个工作线程并发处理
+    {
+        std::stringstream in;
+        for (size_t i = 0; i < requests.size(); i++) {
+            in << PlanningProtocol::formatRequest(requests[i]) << '\n';
+            if (i == 3) {
+                in << "not json\n\n{\"id\":\"p\",\"op\":\"ping\"}\n";
+            }
+        }
+        in << "{\"id\":99,\"start\":[2,2],\"goal\":[500,2]}";  // 末行无换行符
+
+        PlanningServer server(&map, createAlgorithm, 3, 4);
+        std::stringstream out;
+        server.serveStream(in, out);
+
+        std::map<std::string, int> answered;
+        bool matches = true;
+        int errors = 0, pongs = 0;
+        std::string line;
+        while (std::getline(out, line)) {
+            PlanningProtocol::Response response;
+            if (line.find("\"pong\":true") != std::string::npos) {
+                pongs++;
+                continue;
+            }
+            if (!PlanningProtocol::parseResponse(line, response)) {
+                matches = false;
+                continue;
+            }
+            if (!response.error.empty()) {
+                errors++;
+                continue;
+            }
+            answered[response.id]++;
+            auto expected = expectedFitness.find(response.id);
+            if (expected == expectedFitness.end() ||
+                std::fabs(response.fitness - expected->second) > 1e-6 * std::fabs(expected->second)) {
+                matches = false;
+            }
+        }
+        bool once = answered.size() == requests.size();
+        for (const auto& entry : answered) {
+            once = once && entry.second == 1;
+        }
+        PlanningServerStats stats = server.getStats();
+        check("stream mode answers every request once", once && errors == 2 && pongs == 1, failures);
+        check("stream mode matches direct planning", matches, failures);
+        check("stream mode stats", stats.received == requests.size() + 3 && stats.planned == requests.size() &&
+                                   stats.rejected == 2, failures);
+    }
+
+#ifndef _WIN32
+    // Unix 域套接字：两个连接同时流水线发送请求
+    {
+        const std::string path = "/tmp/robonav_test_planning_server.sock";
+        PlanningServer server(&map, createAlgorithm, 2);
+        std::thread serving([&] { server.serveUnixSocket(path); });
+
+        auto runClient = [&](size_t first, size_t count, int& answered, bool& matches) {
+            int fd = -1;
+            for (int attempt = 0; attempt < 100 && fd < 0; attempt++) {
+                fd = UnixSocket::connectTo(path);
+                if (fd < 0) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+                }
+            }
+            if (fd < 0) {
+                return;
+            }
+            std::string batch;
+            for (size_t i = first; i < first + count; i++) {
+                batch += PlanningProtocol::formatRequest(requests[i]) + "\n";
+            }
+            UnixSocket::writeAll(fd, batch);
+            UnixSocket::LineReader reader(fd);
+            std::string line;
+            for (size_t i = 0; i < count && reader.readLine(line); i++) {
+                PlanningProtocol::Response response;
+                if (PlanningProtocol::parseResponse(line, response) && response.error.empty() &&
+                    std::fabs(response.fitness - expectedFitness[response.id]) <= 1e-6 * response.fitness) {
+                    answered++;
+                } else {
+                    matches = false;
+                }
+            }
+            ::close(fd);
+        };
+
+        int answeredA = 0, answeredB = 0;
+        bool matchesA = true, matchesB = true;
+        std::thread clientA([&] { runClient(0, 6, answeredA, matchesA); });
+        std::thread clientB([&] { runClient(6, 6, answeredB, matchesB); });
+        clientA.join();
+        clientB.join();
+        server.stop();
+        serving.join();
+        check("socket mode", answeredA == 6 && answeredB == 6 && matchesA && matchesB, failures);
+    }
+#endif
+
+    if (failures != 0) {
+        std::cout << "Planning server test FAILED" << std::endl;
+        return 1;
+    }
+    std::cout << "Planning server test completed successfully!" << std::endl;
+    return 0;
+}
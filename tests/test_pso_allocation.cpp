@@ -0,0 +1,137 @@
+#include "../include/Common.h"
+#include "../src/core/Map.h"
+#include "../src/core/ThreadPool.h"
+#include "../src/algorithm/ZPSOAlgorithm.h"
+#include "../src/algorithm/HybridAStarPSOAlgorithm.h"
+#include <atomic>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+#if defined(__GNUC__) && !defined(__clang__)
+// 替换全局 operator new/delete 时 GCC 会误报 new 与 free 不匹配
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// 统计全部线程的堆分配次数
+static std::atomic<long> allocationCount(0);
+
+void* operator new(std::size_t size) {
+    allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+// 初始化之后，每一代进化都不应产生堆分配
+static bool checkSwarmGenerations(ThreadPool* pool, bool batch) {
+    const int dimension = 12;
+    std::vector<double> minBounds(dimension, -10.0);
+    std::vector<double> maxBounds(dimension, 10.0);
+    auto sphere = [](ZPSO_Partical& p) {
+        double sum = 0.0;
+        for (double x : p._position) {
+            sum += x * x;
+        }
+        return -sum;
+    };
+    ZPSO_Algorithm pso(sphere, minBounds.data(), maxBounds.data(), dimension, 64, 2.0, 2.0, 1.0, 7);
+    if (batch) {
+        pso.setBatchFitnessFunction([](const double* positions, const double*, int count, int dim, double* fitness) {
+            for (int i = 0; i < count; i++) {
+                double sum = 0.0;
+                for (int j = 0; j < dim; j++) {
+                    sum += positions[i * dim + j] * positions[i * dim + j];
+                }
+                fitness[i] = -sum;
+            }
+        });
+    }
+    pso.setThreadPool(pool);
+    pso.randomlyInitial();
+
+    long before = allocationCount.load();
+    for (int generation = 0; generation < 200; generation++) {
+        pso.update();
+    }
+    long allocations = allocationCount.load() - before;
+
+    std::cout << "swarm (" << (pool ? "parallel" : "serial") << ", "
+              << (batch ? "batch" : "per-particle") << "): "
+              << allocations << " allocations in 200 generations" << std::endl;
+    return allocations == 0;
+}
+
+// 混合算法：进化代数不同的两次规划，分配次数应完全相同
+static bool checkHybridPlan(int threadCount, bool batch) {
+    Map testMap;
+    HybridAStarPSOAlgorithm algorithm;
+    algorithm.setParameter("particleCount", 50);
+    algorithm.setParameter("maxSpeed", 4.0);
+    algorithm.setParameter("threadCount", threadCount);
+    algorithm.setParameter("batchFitness", batch ? 1.0 : 0.0);
+
+    PathPlanningRequest request;
+    request.startPoint = Point(2.0, 2.0);
+    request.endPoint = Point(17.0, 17.0);
+    request.map = &testMap;
+    request.numWaypoints = 6;
+
+    long counts[3];
+    const int generations[3] = {20, 20, 120};
+    for (int run = 0; run < 3; run++) {
+        algorithm.setParameter("generations", generations[run]);
+        long before = allocationCount.load();
+        algorithm.planPath(request);
+        counts[run] = allocationCount.load() - before;
+    }
+    // 第一次运行用于预热（线程池、线程局部缓冲区）
+    long perGeneration = (counts[2] - counts[1]) / (generations[2] - generations[1]);
+    std::cout << "hybrid plan (threads " << threadCount << ", "
+              << (batch ? "batch" : "per-particle") << "): "
+              << counts[1] << " vs " << counts[2] << " allocations, "
+              << perGeneration << " per generation" << std::endl;
+    return counts[1] == counts[2];
+}
+
+int main() {
+    bool ok = true;
+    ok &= checkSwarmGenerations(nullptr, false);
+    ok &= checkSwarmGenerations(nullptr, true);
+    {
+        ThreadPool pool(4);
+        ok &= checkSwarmGenerations(&pool, false);
+        ok &= checkSwarmGenerations(&pool, true);
+    }
+    ok &= checkHybridPlan(1, false);
+    ok &= checkHybridPlan(1, true);
+    ok &= checkHybridPlan(4, true);
+
+    if (!ok) {
+        std::cout << "PSO allocation test FAILED" << std::endl;
+        return 1;
+    }
+    std::cout << "PSO allocation test completed successfully!" << std::endl;
+    return 0;
+}
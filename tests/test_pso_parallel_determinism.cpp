@@ -0,0 +1,62 @@
+#include "../include/Common.h"
+#include "../src/core/Map.h"
+#include "../src/algorithm/HybridAStarPSOAlgorithm.h"
+#include <iostream>
+
+// 相同种子下，串行/并行、逐粒子/批量评估、是否惰性评估、编译期/运行时维度引擎必须得到逐位一致的结果
+static PathPlanningResult runPlan(Map& map, int threadCount, bool batch, bool lazy, bool staticDimension,
+                                  uint64_t seed) {
+    HybridAStarPSOAlgorithm algorithm;
+    algorithm.setParameter("particleCount", 60);
+    algorithm.setParameter("generations", 80);
+    algorithm.setParameter("maxSpeed", 4.0);
+    algorithm.setParameter("threadCount", threadCount);
+    algorithm.setParameter("batchFitness", batch ? 1.0 : 0.0);
+    algorithm.setParameter("lazyEvaluation", lazy ? 1.0 : 0.0);
+    algorithm.setParameter("staticDimension", staticDimension ? 1.0 : 0.0);
+
+    PathPlanningRequest request;
+    request.startPoint = Point(2.0, 2.0);
+    request.endPoint = Point(17.0, 17.0);
+    request.map = &map;
+    request.numWaypoints = 6;
+    request.randomSeed = seed;
+    return algorithm.planPath(request);
+}
+
+int main() {
+    Map testMap;
+    int failures = 0;
+
+    for (uint64_t seed = 1; seed <= 3; seed++) {
+        PathPlanningResult serial = runPlan(testMap, 1, false, true, true, seed);
+        const struct { int threads; bool batch; bool lazy; bool staticDimension; } variants[] = {
+            {2, false, true, true}, {4, false, true, true}, {1, true, true, true}, {3, true, true, true},
+            {5, true, true, true}, {1, false, false, true}, {3, true, false, true},
+            {1, false, true, false}, {3, true, true, false}
+        };
+        for (const auto& variant : variants) {
+            int threads = variant.threads;
+            bool batch = variant.batch;
+            PathPlanningResult parallel = runPlan(testMap, threads, batch, variant.lazy, variant.staticDimension, seed);
+            bool same = serial.fitness == parallel.fitness && serial.path.size() == parallel.path.size();
+            for (size_t i = 0; same && i < serial.path.size(); i++) {
+                same = serial.path[i].x == parallel.path[i].x && serial.path[i].y == parallel.path[i].y;
+            }
+            std::cout << "seed " << seed << ", threads " << threads
+                      << (batch ? ", batch" : ", per-particle") << (variant.lazy ? "" : ", eager")
+                      << (variant.staticDimension ? "" : ", dynamic dimension") << ": "
+                      << (same ? "identical" : "MISMATCH") << std::endl;
+            if (!same) {
+                failures++;
+            }
+        }
+    }
+
+    if (failures != 0) {
+        std::cout << "Parallel determinism test FAILED" << std::endl;
+        return 1;
+    }
+    std::cout << "Parallel determinism test completed successfully!" << std::endl;
+    return 0;
+}
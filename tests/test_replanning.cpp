@@ -0,0 +1,84 @@
+#include "../include/Common.h"
+#include "../src/core/Logger.h"
+#include "../src/core/Map.h"
+#include "../src/core/PathPlanner.h"
+#include "../src/algorithm/HybridAStarPSOAlgorithm.h"
+#include "TestSupport.h"
+#include <iostream>
+
+// 热启动重新规划：起点沿上一次的路径前移后复用引导路径（只做局部A*修复）
+// 并以上一次的最优路径初始化粒子群；终点变化或引导路径失效时退回冷启动
+
+// 沿路径前进给定距离后的位置
+static Point pointAlong(const std::vector<Point>& path, double distance) {
+    for (size_t i = 1; i < path.size(); i++) {
+        double length = path[i-1].distanceTo(path[i]);
+        if (distance <= length) {
+            double t = distance / length;
+            return Point(path[i-1].x + t * (path[i].x - path[i-1].x), path[i-1].y + t * (path[i].y - path[i-1].y));
+        }
+        distance -= length;
+    }
+    return path.back();
+}
+
+int main() {
+    Logger::instance().setLevel(LogLevel::Error);
+    Map map(60, 60, 1.0);
+    buildWallMap(map);
+    const Point start(3.5, 30.5);
+    const Point end(56.5, 30.5);
+    int failures = 0;
+
+    auto algorithm = createTestAlgorithm();
+    check("supports dynamic replanning", algorithm->supportsDynamicReplanning(), failures);
+    PathPlanningResult cold = algorithm->planPath(makeRequest(map, start, end));
+    check("cold plan", cold.success && cold.guidePath.size() >= 2, failures);
+
+    // 前进两个单位后热启动：引导路径只在新起点附近修复
+    Point moved = pointAlong(cold.path, 2.0);
+    PathPlanningResult warm = algorithm->replanPath(makeRequest(map, moved, end), cold);
+    PathPlanningResult reference = createTestAlgorithm()->planPath(makeRequest(map, moved, end));
+    std::cout << "  A* nodes: cold " << reference.stats.nodesExpanded << ", warm " << warm.stats.nodesExpanded
+              << "; generations: cold " << reference.iterations << ", warm " << warm.iterations << std::endl;
+    check("guide path repaired",
+          warm.stats.nodesExpanded * 10 < reference.stats.nodesExpanded &&
+          warm.guidePath.front().distanceTo(moved) < 1e-9 && warm.guidePath.back().distanceTo(end) < 1e-9, failures);
+    check("warm plan", warm.success && warm.path.front().distanceTo(moved) < 1e-9 &&
+                       warm.iterations <= 50, failures);
+
+    // 终点变化：上一次的结果不可复用，结果与冷启动逐位一致
+    Point otherEnd(56.5, 10.5);
+    PathPlanningResult fallback = algorithm->replanPath(makeRequest(map, moved, otherEnd), cold);
+    PathPlanningResult coldOther = createTestAlgorithm()->planPath(makeRequest(map, moved, otherEnd));
+    check("changed goal falls back to cold plan",
+          fallback.fitness == coldOther.fitness && fallback.iterations == coldOther.iterations &&
+          fallback.stats.nodesExpanded == coldOther.stats.nodesExpanded, failures);
+
+    // 引导路径上出现新障碍：重新运行完整A*
+    Map blocked = map;
+    const Point& ahead = cold.guidePath[cold.guidePath.size() / 2];
+    blocked.setCell(static_cast<int>(ahead.x), static_cast<int>(ahead.y), 1);
+    PathPlanningResult rerouted = algorithm->replanPath(makeRequest(blocked, moved, end), cold);
+    PathPlanningResult coldBlocked = createTestAlgorithm()->planPath(makeRequest(blocked, moved, end));
+    check("blocked guide path runs full A*",
+          rerouted.stats.nodesExpanded == coldBlocked.stats.nodesExpanded &&
+          rerouted.guidePath.size() == coldBlocked.guidePath.size(), failures);
+
+    // PathPlanner 连续多次前移起点
+    PathPlanner planner(&map, start, end, createTestAlgorithm());
+    PathPlanningResult step = planner.planPath();
+    bool allSucceeded = step.success;
+    for (int i = 0; i < 6 && allSucceeded; i++) {
+        step = planner.replan(pointAlong(step.path, 1.5));
+        allSucceeded = step.success;
+    }
+    check("planner replans along the path", allSucceeded, failures);
+
+    if (failures != 0) {
+        std::cout << "Replanning test FAILED" << std::endl;
+        return 1;
+    }
+    std::cout << "Replanning test completed successfully!" << std::endl;
+    return 0;
+}
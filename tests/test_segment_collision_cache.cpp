@@ -0,0 +1,79 @@
+#include "../include/Common.h"
+#include "../src/core/Map.h"
+#include "../src/algorithm/SegmentCollisionCache.h"
+#include "../src/algorithm/ZPSOAlgorithm.h"
+#include <iostream>
+#include <thread>
+
+// 缓存结果必须与 Map::isLineColliding 完全一致，且重复查询应命中缓存
+static int checkSegments(const Map& map, SegmentCollisionCache& cache, uint64_t seed,
+                         long& hits, long& lookups) {
+    ZPSO_Random random(seed);
+    int mismatches = 0;
+    const double width = map.getWidth() * map.getCellSize();
+    const double height = map.getHeight() * map.getCellSize();
+    for (int k = 0; k < 20000; k++) {
+        // 端点限制在少量网格内，使大量查询重复；偶尔取地图外的点
+        Point a(random.rand0_1() * width * 0.5, random.rand0_1() * height * 0.5);
+        Point b(random.rand0_1() * (width + 2.0) - 1.0, random.rand0_1() * (height + 2.0) - 1.0);
+        bool hit;
+        bool cached = cache.isLineColliding(map, a, b, hit);
+        if (cached != map.isLineColliding(a, b)) {
+            mismatches++;
+        }
+        hits += hit ? 1 : 0;
+        lookups++;
+    }
+    return mismatches;
+}
+
+int main() {
+    Map testMap;
+    int failures = 0;
+
+    // 单线程：容量很小时探测失败只会退回直接计算
+    const size_t capacities[] = {64, 1 << 16};
+    for (size_t capacity : capacities) {
+        SegmentCollisionCache cache(capacity);
+        cache.reset(testMap.getCellSize());
+        long hits = 0, lookups = 0;
+        int mismatches = checkSegments(testMap, cache, 7, hits, lookups);
+        mismatches += checkSegments(testMap, cache, 7, hits, lookups);
+        std::cout << "capacity " << cache.capacity() << ": " << mismatches << " mismatches, "
+                  << hits << "/" << lookups << " hits" << std::endl;
+        if (mismatches != 0 || (capacity > 64 && hits < 20000)) {
+            failures++;
+        }
+    }
+
+    // 多线程同时查询与写入
+    SegmentCollisionCache shared(1 << 12);
+    shared.reset(testMap.getCellSize());
+    int threadMismatches[4] = {0, 0, 0, 0};
+    long threadHits[4] = {0, 0, 0, 0};
+    long threadLookups[4] = {0, 0, 0, 0};
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&, t] {
+            threadMismatches[t] = checkSegments(testMap, shared, 100 + t % 2, threadHits[t], threadLookups[t]);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    int concurrentMismatches = 0;
+    for (int t = 0; t < 4; t++) {
+        concurrentMismatches += threadMismatches[t];
+    }
+    std::cout << "concurrent: " << concurrentMismatches << " mismatches" << std::endl;
+    if (concurrentMismatches != 0) {
+        failures++;
+    }
+
+    if (failures != 0) {
+        std::cout << "Segment collision cache test FAILED" << std::endl;
+        return 1;
+    }
+    std::cout << "Segment collision cache test completed successfully!" << std::endl;
+    return 0;
+}